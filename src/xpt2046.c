@@ -25,17 +25,94 @@
 #include <string.h>
 
 #include "xpt2046.h"
-#include "xpt2046_low_if.h"
+#include "xpt2046_backend.h"
+#include "xpt2046_backend_adc.h"
+#include "xpt2046_pressure.h"
+#include "xpt2046_class.h"
+#include "xpt2046_heatmap.h"
+#include "xpt2046_shape.h"
+#include "xpt2046_evt.h"
+#include "xpt2046_stream.h"
+#include "xpt2046_inject.h"
+#include "xpt2046_par.h"
+#include "xpt2046_roi.h"
+#include "xpt2046_noise.h"
+#include "xpt2046_clk.h"
+#include "xpt2046_conf.h"
+#include "xpt2046_lock.h"
+#include "xpt2046_ink.h"
+#include "xpt2046_log.h"
+#include "xpt2046_mem.h"
 #include "../../xpt2046_cfg.h"
-#include "../../xpt2046_if.h"
+
+// Factory calibration (generated by tools/cal/xpt2046_cal_gen.py)
+#if ( 1 == XPT2046_CAL_BAKED_EN )
+	#include "../../xpt2046_cal_baked.h"
+#endif
 
 // Display
-#include "drivers/devices/ili9488/ili9488/src/ili9488.h"
+#if ( 1 == XPT2046_CAL_GUI_EN )
+	#include "drivers/devices/ili9488/ili9488/src/ili9488.h"
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+// Run-time calibration (FSM and factor storage)
+#if (( 0 == XPT2046_CAL_BAKED_EN ) || ( 1 == XPT2046_CAL_BAKED_OVERRIDE_EN ))
+	#define XPT2046_CAL_RUNTIME_EN				( 1 )
+#else
+	#define XPT2046_CAL_RUNTIME_EN				( 0 )
+#endif
+
+#if ( 1 == XPT2046_CAL_BAKED_EN )
+
+	/**
+	 * 	Baked factors in Q16 fixed point, divisor folded in at compile time
+	 *
+	 * 		Dx = ( KXX * Tx + KXY * Ty + KX0 ) >> 16
+	 * 		Dy = ( KYX * Tx + KYY * Ty + KY0 ) >> 16
+	 *
+	 * 	Factors are rounded to nearest and offsets carry half pixel, thus
+	 * 	shift rounds result to nearest pixel.
+	 */
+	#define XPT2046_CAL_BAKED_Q					( 16 )
+	#define XPT2046_CAL_BAKED_ONE				( 65536LL )
+	#define XPT2046_CAL_BAKED_HALF				( 32768LL )
+	#define XPT2046_CAL_BAKED_K(f)				(((( f ) * XPT2046_CAL_BAKED_ONE ) + (((( f ) < 0 ) == ( XPT2046_CAL_BAKED_F0 < 0 )) ? ( XPT2046_CAL_BAKED_F0 / 2 ) : -( XPT2046_CAL_BAKED_F0 / 2 ))) / XPT2046_CAL_BAKED_F0 )
+	#define XPT2046_CAL_BAKED_ABS(k)			((( k ) < 0 ) ? ( -( k )) : ( k ))
+
+	#define XPT2046_CAL_BAKED_KXX				XPT2046_CAL_BAKED_K( XPT2046_CAL_BAKED_F1 )
+	#define XPT2046_CAL_BAKED_KXY				XPT2046_CAL_BAKED_K( XPT2046_CAL_BAKED_F2 )
+	#define XPT2046_CAL_BAKED_KX0				( XPT2046_CAL_BAKED_K( XPT2046_CAL_BAKED_F3 ) + XPT2046_CAL_BAKED_HALF )
+	#define XPT2046_CAL_BAKED_KYX				XPT2046_CAL_BAKED_K( XPT2046_CAL_BAKED_F4 )
+	#define XPT2046_CAL_BAKED_KYY				XPT2046_CAL_BAKED_K( XPT2046_CAL_BAKED_F5 )
+	#define XPT2046_CAL_BAKED_KY0				( XPT2046_CAL_BAKED_K( XPT2046_CAL_BAKED_F6 ) + XPT2046_CAL_BAKED_HALF )
+
+	#if ( 0 == XPT2046_CAL_BAKED_F0 )
+		#error "Baked calibration divisor (F0) is zero!"
+	#endif
+
+	// Full 12-bit raw range must fit into 32-bit accumulator
+	#if ((( XPT2046_CAL_BAKED_ABS( XPT2046_CAL_BAKED_KXX ) + XPT2046_CAL_BAKED_ABS( XPT2046_CAL_BAKED_KXY )) * 4095 + XPT2046_CAL_BAKED_ABS( XPT2046_CAL_BAKED_KX0 )) > 2147483647 )
+		#error "Baked calibration X factors out of fixed point range!"
+	#endif
+
+	#if ((( XPT2046_CAL_BAKED_ABS( XPT2046_CAL_BAKED_KYX ) + XPT2046_CAL_BAKED_ABS( XPT2046_CAL_BAKED_KYY )) * 4095 + XPT2046_CAL_BAKED_ABS( XPT2046_CAL_BAKED_KY0 )) > 2147483647 )
+		#error "Baked calibration Y factors out of fixed point range!"
+	#endif
+
+#endif
+
+// Pipeline stage profiling hooks
+#if ( 0 == XPT2046_PROF_EN )
+	#undef XPT2046_PROF_BEGIN
+	#undef XPT2046_PROF_END
+	#define XPT2046_PROF_BEGIN(stage)			{ ; }
+	#define XPT2046_PROF_END(stage)				{ ; }
+#endif
+
 // Max. FSM state
 #define XPT2046_LIMIT_FMS_MS					( 1000000UL ) // [ms]
 #define XPT2046_LIMIT_FMS_DURATION(time)		(( time > XPT2046_LIMIT_FMS_MS ) ? ( XPT2046_LIMIT_FMS_MS ) : ( time ))
@@ -46,9 +123,27 @@ typedef struct
 	uint16_t 	page;
 	uint16_t 	col;
 	uint16_t 	force;
+	uint16_t	force_raw;
+	uint16_t	motion;
+	uint8_t		conf;
 	bool		pressed;
+	uint16_t	raw_x;		// Uncalibrated position, captured by calibration
+	uint16_t	raw_y;
 } xpt2046_touch_t;
 
+// Acquisition history
+typedef struct
+{
+	uint32_t	down_tick;		// Pen-down time of current touch
+	uint16_t	X_prev;			// Last valid controller sample
+	uint16_t	Y_prev;
+	uint16_t	force_prev;
+	uint8_t		release_cnt;	// Released samples during release debounce
+	bool		pressed_prev;	// Pressed state at previous confidence calculation
+} xpt2046_hist_t;
+
+XPT2046_MEM_CHECK( core, XPT2046_MEM_SIZE( sizeof( xpt2046_touch_t )) + XPT2046_MEM_SIZE( sizeof( xpt2046_hist_t )), XPT2046_MEM_CORE );
+
 // Point
 typedef struct
 {
@@ -67,14 +162,25 @@ typedef enum
 } xpt2046_points_t;
 
 // Calibration data
+//
+// NOTE: Factors are double buffered. New factors are written to pending
+// buffer under sequence counter (odd while writing). Touch handler copies
+// complete pending factors to inactive buffer and switches active index,
+// so buffer in use is never written.
+//
+// NOTE: Fields used by touch handler on each cycle come first.
 typedef struct
 {
-	xpt2046_point_t 	Dp[ eXPT2046_CAL_P_NUM_OF ];	// Display points (predefined)
-	xpt2046_point_t 	Tp[ eXPT2046_CAL_P_NUM_OF ];	// Touch points
-	int32_t				factors[ 7 ];					// Calibration factors
+	int32_t				factors[ 2 ][ XPT2046_CAL_FACTORS_NUM ];	// Calibration factors
+	volatile uint8_t	active;							// Index of active factors
+	volatile bool 		done;							// Active factors are valid
+	uint32_t			seq_taken;						// Sequence of last taken pending factors
+	volatile uint32_t	seq;							// Pending factors sequence
+	volatile int32_t	pending[ XPT2046_CAL_FACTORS_NUM ];	// Pending factors
 	bool				start;
 	bool				busy;
-	bool 				done;
+	xpt2046_point_t 	Dp[ eXPT2046_CAL_P_NUM_OF ];	// Display points
+	xpt2046_point_t 	Tp[ eXPT2046_CAL_P_NUM_OF ];	// Touch points
 } xpt2046_cal_data_t;
 
 // FSM states
@@ -93,6 +199,7 @@ typedef struct
 	struct
 	{
 		uint32_t 	duration;
+		uint32_t	tick;			// Time of last manager call
 		bool 		first_entry;
 	} time;
 
@@ -101,8 +208,14 @@ typedef struct
 		xpt2046_cal_state_t cur;
 		xpt2046_cal_state_t next;
 	} state;
+
+	bool	point_touched;			// Calibration point touched
 } xpt2046_fsm_t;
 
+#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+	XPT2046_MEM_CHECK( cal, XPT2046_MEM_SIZE( sizeof( xpt2046_cal_data_t )) + XPT2046_MEM_SIZE( sizeof( xpt2046_fsm_t )), XPT2046_MEM_CAL );
+#endif
+
 #if ( 1 == XPT2046_FILTER_EN )
 
 	// Filter data
@@ -110,6 +223,7 @@ typedef struct
 	{
 		uint16_t samp_buf[ XPT2046_FILTER_WIN_SAMP ];
 		uint32_t sum;
+		uint8_t  outlier_cnt;	// Consecutive samples beyond outlier limit
 	} xpt2046_filt_data_t;
 
 	// Filter objects
@@ -118,8 +232,13 @@ typedef struct
 		xpt2046_filt_data_t x;
 		xpt2046_filt_data_t y;
 		xpt2046_filt_data_t force;
+		uint8_t				idx;	// Index of next sample
+		uint8_t				win;	// Current window
+		bool				touch_prev;
 	} xpt2046_filter_t;
 
+	XPT2046_MEM_CHECK( filter, XPT2046_MEM_SIZE( sizeof( xpt2046_filter_t )), XPT2046_MEM_FILTER );
+
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -127,64 +246,135 @@ typedef struct
 ////////////////////////////////////////////////////////////////////////////////
 
 // Touch data
-static xpt2046_touch_t g_touch;
+static xpt2046_touch_t * gp_touch = NULL;
 
-// Calibration data
-static xpt2046_cal_data_t g_cal_data =
-{
-	// Predefined display points
-	.Dp =
-	{
-		XPT2046_POINT_1_XY,
-		XPT2046_POINT_2_XY,
-		XPT2046_POINT_3_XY,
-	},
+// Acquisition history
+static xpt2046_hist_t * gp_hist = NULL;
 
-	.start = false,
-	.busy = false,
-	.done = false
-};
+#if ( 1 == XPT2046_FILTER_EN )
 
-// FSM handler
-static xpt2046_fsm_t g_cal_fsm;
+	// Filter
+	static xpt2046_filter_t * gp_filter = NULL;
 
-// Calibration point
-ili9488_circ_attr_t g_cal_circ_attr =
-{
-	.position.radius	= XPT2046_POINT_SIZE,
+#endif
+
+// Controller backend
+static const xpt2046_backend_t * const gp_backend = &XPT2046_BACKEND;
 
-	.border.enable		= false,
-	.border.width		= 0,
-	.border.color		= eILI9488_COLOR_BLACK,
+#if ( 1 == XPT2046_CAL_RUNTIME_EN )
 
-	.fill.enable		= true,
-};
+	// Calibration data
+	// NOTE: Display points are loaded from parameter registry at calibration start
+	static xpt2046_cal_data_t * gp_cal_data = NULL;
+
+	// FSM handler
+	static xpt2046_fsm_t * gp_cal_fsm = NULL;
+
+	#if ( 1 == XPT2046_CAL_GUI_EN )
+
+		// Calibration point
+		ili9488_circ_attr_t g_cal_circ_attr =
+		{
+			.position.radius	= XPT2046_POINT_SIZE,
+
+			.border.enable		= false,
+			.border.width		= 0,
+			.border.color		= eILI9488_COLOR_BLACK,
+
+			.fill.enable		= true,
+		};
+
+	#endif
+
+#endif
+
+#if ( 1 == XPT2046_CAL_BAKED_EN )
+
+	// Factory calibration factors
+	// NOTE: Only needed by region of interest and factor readout
+	static const int32_t gc_cal_baked_factors[ XPT2046_CAL_FACTORS_NUM ] =
+	{
+		XPT2046_CAL_BAKED_F0, XPT2046_CAL_BAKED_F1, XPT2046_CAL_BAKED_F2, XPT2046_CAL_BAKED_F3,
+		XPT2046_CAL_BAKED_F4, XPT2046_CAL_BAKED_F5, XPT2046_CAL_BAKED_F6
+	};
+
+#endif
 
 // Initialization done flag
 static bool gb_is_init = false;
 
+// Controller in sleep flag
+static bool gb_is_asleep = false;
+
+#if ( 0 == XPT2046_CLASS_EN )
+
+	// Fixed processing profile
+	static const xpt2046_profile_t g_profile =
+	{
+		.filt_win		= XPT2046_FILTER_WIN_SAMP,
+		.outlier_lim	= UINT16_MAX,
+		.release_deb	= 0U,
+	};
+
+#endif
+
+// Active processing profile
+static const xpt2046_profile_t * gp_profile;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_alloc_core			(void);
+static void 	xpt2046_acquire_data				(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_is_pressed);
 static void 	xpt2046_read_data_from_controler	(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_is_pressed);
-static void 	xpt2046_calibrate_data				(uint16_t * const p_X, uint16_t * const p_Y, const int32_t * const p_factors);
-static void 	xpt2046_cal_hndl					(void);
-static void 	xpt2046_calculate_factors			(int32_t * p_factors, const xpt2046_point_t * const p_Dp, const xpt2046_point_t * const p_Tp);
+static uint16_t	xpt2046_calc_resistance				(const uint16_t X, const uint16_t Z1, const uint16_t Z2);
+static const int32_t * xpt2046_cal_get_active		(bool * const p_is_runtime);
 static int32_t 	xpt2046_limit_cal_Y_data			(const int32_t unlimited_data);
 static int32_t 	xpt2046_limit_cal_X_data			(const int32_t unlimited_data);
+static bool		xpt2046_cal_is_busy					(void);
+
+#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+	static xpt2046_status_t xpt2046_alloc_cal_data	(void);
+	static xpt2046_status_t xpt2046_alloc_cal_fsm	(void);
+	static void 	xpt2046_calibrate_data				(uint16_t * const p_X, uint16_t * const p_Y, const int32_t * const p_factors);
+	static void		xpt2046_cal_commit					(const int32_t * const p_factors);
+	static void		xpt2046_cal_take_pending			(void);
+	static void 	xpt2046_cal_hndl					(void);
+	static void 	xpt2046_calculate_factors			(int32_t * p_factors, const xpt2046_point_t * const p_Dp, const xpt2046_point_t * const p_Tp);
+
+	static void xpt2046_fms_manager			(void);
+	static void xpt2046_fsm_normal			(void);
+	static void xpt2046_fsm_p1_acq			(void);
+	static void xpt2046_fsm_p2_acq			(void);
+	static void xpt2046_fsm_p3_acq			(void);
+	static void xpt2046_fsm_calc_factors	(void);
+
+	static void xpt2046_set_cal_point		(const xpt2046_points_t px);
+	static void xpt2046_clear_cal_point		(const xpt2046_points_t px);
+#endif
+
+#if ( 1 == XPT2046_CAL_BAKED_EN )
+	static void		xpt2046_calibrate_baked				(uint16_t * const p_X, uint16_t * const p_Y);
+#endif
+
+static void xpt2046_pen_state			(bool * const p_is_pressed);
+
+#if ( 1 == XPT2046_CONF_EN )
+	static void xpt2046_confidence		(const bool is_live);
+#endif
 
-static void xpt2046_fms_manager			(void);
-static void xpt2046_fsm_normal			(void);
-static void xpt2046_fsm_p1_acq			(void);
-static void xpt2046_fsm_p2_acq			(void);
-static void xpt2046_fsm_p3_acq			(void);
-static void xpt2046_fsm_calc_factors	(void);
+#if ( 1 == XPT2046_EVT_EN )
+	static void xpt2046_gen_events		(const bool is_cal);
+#endif
 
-static void xpt2046_set_cal_point		(const xpt2046_points_t px);
-static void xpt2046_clear_cal_point		(const xpt2046_points_t px);
+#if ( 1 == XPT2046_CLASS_EN )
+	static void xpt2046_classify		(const uint16_t X, const uint16_t Y, const uint16_t force, const bool is_pressed);
+#endif
 
 #if ( XPT2046_FILTER_EN )
-	static void xpt2046_filter_data(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_touch);
+	static void 	xpt2046_filter_data		(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_touch);
+	static uint16_t xpt2046_filter_axis		(xpt2046_filt_data_t * const p_filt, const uint16_t samp, const uint8_t idx, const uint8_t win, const uint16_t outlier_lim);
+	static void		xpt2046_filter_resum	(xpt2046_filt_data_t * const p_filt, const uint8_t idx, const uint8_t win);
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -204,17 +394,86 @@ xpt2046_status_t xpt2046_init(void)
 
 	XPT2046_ASSERT( false == gb_is_init );
 
-	// Initialize low level drivers
-	status = xpt2046_if_init();
+	// Initialize controller
+	status = gp_backend->pf_init();
 
-	// Initialize FSM
-	g_cal_fsm.state.cur = eXPT2046_FSM_NORMAL;
-	g_cal_fsm.state.next = eXPT2046_FSM_NORMAL;
-	g_cal_fsm.time.duration = 0;
-	g_cal_fsm.time.first_entry = false;
+	// Take driver memory
+	status |= xpt2046_mem_reset();
+
+	// Allocate state in order of use by touch handler
+	// NOTE: State used on each handler cycle comes first, rarely used last
+	if ( eXPT2046_OK == status )
+	{
+		status |= xpt2046_alloc_core();
+
+		// Initialize parameters
+		status |= xpt2046_par_init();
+
+		#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+			status |= xpt2046_alloc_cal_data();
+		#endif
+
+		#if ( 1 == XPT2046_LOCK_EN )
+			status |= xpt2046_lock_init();
+		#endif
+
+		// Initialize processing profile
+		#if ( 1 == XPT2046_CLASS_EN )
+			status |= xpt2046_class_init();
+			gp_profile = xpt2046_class_get_profile();
+		#else
+			gp_profile = &g_profile;
+		#endif
+
+		// Initialize pressure calibration
+		#if ( 1 == XPT2046_PRESSURE_EN )
+			status |= xpt2046_pressure_init();
+		#endif
+
+		#if ( 1 == XPT2046_ROI_EN )
+			status |= xpt2046_roi_init();
+		#endif
+
+		#if ( 1 == XPT2046_EVT_EN )
+			status |= xpt2046_evt_init();
+		#endif
+
+		#if ( 1 == XPT2046_STREAM_EN )
+			status |= xpt2046_stream_init();
+		#endif
+
+		#if ( 1 == XPT2046_INK_EN )
+			status |= xpt2046_ink_init();
+		#endif
+
+		#if ( 1 == XPT2046_HEATMAP_EN )
+			status |= xpt2046_heatmap_init();
+		#endif
+
+		#if ( 1 == XPT2046_SHAPE_EN )
+			status |= xpt2046_shape_init();
+		#endif
+
+		#if ( 1 == XPT2046_INJECT_EN )
+			status |= xpt2046_inject_init();
+		#endif
+
+		#if ( 1 == XPT2046_NOISE_EN )
+			status |= xpt2046_noise_init();
+		#endif
+
+		#if ( 1 == XPT2046_CLK_TUNE_EN )
+			status |= xpt2046_clk_init();
+		#endif
+
+		// Initialize FSM
+		#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+			status |= xpt2046_alloc_cal_fsm();
+		#endif
+	}
 
 	// Init done
-	gb_is_init = true;
+	gb_is_init = ( eXPT2046_OK == status );
 
 	XPT2046_ASSERT( status == eXPT2046_OK );
 
@@ -235,39 +494,941 @@ bool xpt2046_is_init(void)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*			Get touch data
+*			Get touch data
+*
+* @note		When XPT2046_PRESSURE_EN is enabled force is normalized
+* 			pressure in range 0-1023, otherwise raw touch resistance.
+*
+* @param[out]	p_page 		- Pointer to page (x) coordinate
+* @param[out]	p_col 		- Pointer to column (y) coordinate
+* @param[out]	p_force 	- Pointer to pressure (force) of touch
+* @param[out]	p_pressed 	- Pointer to pressed flag
+* @return		status 		- Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_get_touch(uint16_t * const p_page, uint16_t * const p_col, uint16_t * const p_force, bool * const p_pressed)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	if ( true == gb_is_init )
+	{
+		if ( NULL != p_page )
+		{
+			*p_page 	= gp_touch->page;
+		}
+
+		if ( NULL != p_col )
+		{
+			*p_col 		= gp_touch->col;
+		}
+
+		if ( NULL != p_force )
+		{
+			*p_force 	= gp_touch->force;
+		}
+
+		if ( NULL != p_pressed )
+		{
+			*p_pressed 	= gp_touch->pressed;
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*			Get raw touch resistance
+*
+* @note		Used for pressure calibration. Value is valid only while touch
+* 			is pressed and backend measures pressure.
+*
+* @param[out]	p_resistance	- Pointer to raw (filtered) touch resistance
+* @return		status 			- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_get_touch_resistance(uint16_t * const p_resistance)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	if 	(	( NULL != p_resistance )
+		&&	( true == gb_is_init )
+		&&	( true == gp_backend->pressure )
+		&&	( true == gp_touch->pressed ))
+	{
+		*p_resistance = gp_touch->force_raw;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*			Get motion within acquisition burst
+*
+* @note		Measured only with symmetric burst (XPT2046_SYM_BURST_EN),
+* 			otherwise zero. Value is valid only while touch is pressed.
+*
+* @param[out]	p_motion	- Pointer to sum of X and Y change within burst [ADC]
+* @return		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_get_burst_motion(uint16_t * const p_motion)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	if 	(	( NULL != p_motion )
+		&&	( true == gb_is_init )
+		&&	( true == gp_touch->pressed ))
+	{
+		*p_motion = gp_touch->motion;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*			Get confidence of current touch sample
+*
+* @note		Score combines time since pen-down, pressure, position spread
+* 			within acquisition and release debounce status. Low score
+* 			samples can be skipped by hit-testing and gesture logic.
+*
+* @param[out]	p_conf	- Pointer to confidence score (0-XPT2046_CONF_MAX)
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_get_confidence(uint8_t * const p_conf)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	#if ( 1 == XPT2046_CONF_EN )
+		if 	(	( NULL != p_conf )
+			&&	( true == gb_is_init )
+			&&	( true == gp_touch->pressed ))
+		{
+			*p_conf = gp_touch->conf;
+		}
+		else
+		{
+			status = eXPT2046_ERROR;
+		}
+	#else
+		(void) p_conf;
+		status = eXPT2046_ERROR;
+	#endif
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read auxiliary channel of controller
+*
+* @note		Shall be called from same context as xpt2046_hndl().
+*
+* @param[in]	ch		- Auxiliary channel
+* @param[out]	p_val	- Pointer to conversion result
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_read_aux(const xpt2046_aux_t ch, uint16_t * const p_val)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	if 	(	( NULL != p_val )
+		&&	( false == gb_is_asleep ))
+	{
+		status = gp_backend->pf_read_aux( ch, p_val );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Put controller to sleep before MCU enters low power mode
+*
+* @note		Controller is powered down with PENIRQ enabled, thus touch
+* 			pulls PENIRQ low and can wake MCU. No conversion is made
+* 			until xpt2046_sleep_exit(), touch handler reports no touch
+* 			meanwhile.
+*
+* 			Pipeline state is kept in RAM. Sleep is refused while touch
+* 			(including release debounce) or calibration is in progress,
+* 			thus every DOWN event has its UP event before sleep and
+* 			filter starts with fresh window on wake. Application shall
+* 			retry after next handler call.
+*
+* 			Shall be called from same context as xpt2046_hndl().
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_sleep_enter(void)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	if 	(	( true == gb_is_init )
+		&&	( false == gp_touch->pressed )
+		&&	( false == xpt2046_cal_is_busy()))
+	{
+		status = gp_backend->pf_set_power( eXPT2046_POWER_DOWN );
+
+		if ( eXPT2046_OK == status )
+		{
+			gb_is_asleep = true;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wake controller after MCU low power mode
+*
+* @note		Runs one touch handler cycle immediately, thus when wake
+* 			was caused by touch, first burst gives valid coordinate
+* 			(filter window is seeded with it). X, Y and Z are ratiometric
+* 			conversions and need no reference settling after power down.
+*
+* 			Shall be called from same context as xpt2046_hndl(), not from
+* 			PENIRQ interrupt.
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_sleep_exit(void)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	if ( true == gb_is_asleep )
+	{
+		gb_is_asleep = false;
+		xpt2046_hndl();
+		status = eXPT2046_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Main touch controller handler
+*
+* @note 	Shall be called periodically every 10ms.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_hndl(void)
+{
+	uint16_t X;
+	uint16_t Y;
+	uint16_t force;
+	bool is_pressed;
+	bool is_cal;
+	bool is_runtime;
+	const int32_t * p_factors;
+
+	#if ( 1 == XPT2046_INJECT_EN )
+		xpt2046_inject_samp_t inj;
+	#endif
+
+	#if ( 1 == XPT2046_CONF_EN )
+		bool is_live;
+	#endif
+
+	XPT2046_ASSERT( true == gb_is_init );
+
+	// Apply pending parameter changes
+	xpt2046_par_apply();
+
+	// Switch to newly committed calibration
+	#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+		xpt2046_cal_take_pending();
+	#endif
+
+	// Take active calibration for whole cycle
+	p_factors = xpt2046_cal_get_active( &is_runtime );
+	is_cal = ( NULL != p_factors );
+
+	// Script player
+	#if ( 1 == XPT2046_INJECT_EN )
+		xpt2046_inject_hndl();
+	#endif
+
+	// Get data
+	XPT2046_PROF_BEGIN( eXPT2046_PROF_ACQUIRE );
+	xpt2046_acquire_data( &X, &Y, &force, &is_pressed );
+	XPT2046_PROF_END( eXPT2046_PROF_ACQUIRE );
+
+	XPT2046_PROF_BEGIN( eXPT2046_PROF_CONTACT );
+
+	// Reject samples that can not hit any active region
+	// NOTE: Calibration points must stay reachable during re-calibration
+	#if ( 1 == XPT2046_ROI_EN )
+		if 	(	( true == is_pressed )
+			&&	( true == is_cal )
+			&&	( false == xpt2046_cal_is_busy() )
+			&&	( false == xpt2046_roi_check( X, Y, p_factors )))
+		{
+			is_pressed = false;
+		}
+	#endif
+
+	// Classify contact
+	// NOTE: Classification needs touch resistance, default profile is used otherwise
+	#if ( 1 == XPT2046_CLASS_EN )
+		if ( true == gp_backend->pressure )
+		{
+			xpt2046_classify( X, Y, force, is_pressed );
+		}
+	#endif
+
+	// Pressed state before release debounce
+	#if ( 1 == XPT2046_CONF_EN )
+		is_live = is_pressed;
+	#endif
+
+	// Debounce pen release
+	xpt2046_pen_state( &is_pressed );
+
+	XPT2046_PROF_END( eXPT2046_PROF_CONTACT );
+
+	XPT2046_PROF_BEGIN( eXPT2046_PROF_FILTER );
+
+	// Apply filter
+	#if ( 1 == XPT2046_FILTER_EN )
+		xpt2046_filter_data( &X, &Y, &force, &is_pressed );
+	#endif
+
+	// Lock position of resting contact
+	#if ( 1 == XPT2046_LOCK_EN )
+		xpt2046_lock_apply( &X, &Y, is_pressed );
+	#endif
+
+	XPT2046_PROF_END( eXPT2046_PROF_FILTER );
+
+	// Keep uncalibrated position for calibration routine
+	gp_touch->raw_x = X;
+	gp_touch->raw_y = Y;
+
+	// Apply calibration
+	// NOTE: While re-calibration runs previous factors stay active
+	XPT2046_PROF_BEGIN( eXPT2046_PROF_CALIBRATE );
+
+	if ( true == is_runtime )
+	{
+		#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+			xpt2046_calibrate_data( &X, &Y, p_factors );
+		#endif
+	}
+	else if ( true == is_cal )
+	{
+		// Factory calibration
+		#if ( 1 == XPT2046_CAL_BAKED_EN )
+			xpt2046_calibrate_baked( &X, &Y );
+		#endif
+	}
+	else
+	{
+		// No actions...
+	}
+
+	XPT2046_PROF_END( eXPT2046_PROF_CALIBRATE );
+
+	XPT2046_PROF_BEGIN( eXPT2046_PROF_OUTPUT );
+
+	// Store
+	gp_touch->page = X;
+	gp_touch->col = Y;
+	gp_touch->force_raw = force;
+	gp_touch->pressed = is_pressed;
+
+	// Convert touch resistance to pressure
+	#if ( 1 == XPT2046_PRESSURE_EN )
+		gp_touch->force = (( true == is_pressed ) && ( true == gp_backend->pressure )) ? xpt2046_pressure_calc( force ) : 0U;
+	#else
+		gp_touch->force = force;
+	#endif
+
+	// Injection after calibration
+	#if ( 1 == XPT2046_INJECT_EN )
+		if ( true == xpt2046_inject_take( eXPT2046_INJECT_CAL, &inj ))
+		{
+			gp_touch->page = inj.x;
+			gp_touch->col = inj.y;
+			gp_touch->force = inj.force;
+			gp_touch->pressed = inj.pressed;
+			is_cal = true;
+		}
+	#endif
+
+	// Sample confidence
+	#if ( 1 == XPT2046_CONF_EN )
+		xpt2046_confidence( is_live );
+	#endif
+
+	// Draw ink straight to display
+	#if ( 1 == XPT2046_INK_EN )
+		if ( true == is_cal )
+		{
+			xpt2046_ink_from_touch( gp_touch->page, gp_touch->col, gp_touch->pressed );
+		}
+	#endif
+
+	// Panel wear statistics
+	#if ( 1 == XPT2046_HEATMAP_EN )
+		if ( true == is_cal )
+		{
+			xpt2046_heatmap_add( gp_touch->page, gp_touch->col, gp_touch->force, gp_touch->pressed );
+		}
+	#endif
+
+	// Symbol input
+	#if ( 1 == XPT2046_SHAPE_EN )
+		if ( true == is_cal )
+		{
+			xpt2046_shape_add( gp_touch->page, gp_touch->col, gp_touch->pressed );
+		}
+	#endif
+
+	XPT2046_PROF_END( eXPT2046_PROF_OUTPUT );
+
+	// Generate events
+	#if ( 1 == XPT2046_EVT_EN )
+		XPT2046_PROF_BEGIN( eXPT2046_PROF_EVENTS );
+		xpt2046_gen_events( is_cal );
+		XPT2046_PROF_END( eXPT2046_PROF_EVENTS );
+	#endif
+
+	// Calibration handler
+	#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+		xpt2046_cal_hndl();
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Allocate touch data, acquisition history and filter
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_alloc_core(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_touch = xpt2046_mem_alloc( sizeof( xpt2046_touch_t ));
+	gp_hist = xpt2046_mem_alloc( sizeof( xpt2046_hist_t ));
+
+	if 	(	( NULL == gp_touch )
+		||	( NULL == gp_hist ))
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	#if ( 1 == XPT2046_FILTER_EN )
+		gp_filter = xpt2046_mem_alloc( sizeof( xpt2046_filter_t ));
+
+		if ( NULL == gp_filter )
+		{
+			status = eXPT2046_ERROR;
+		}
+	#endif
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Acquire raw touch data
+*
+* @note		Injected raw samples take precedence over controller data.
+*
+* @param[out]	p_X				- Pointer to x coordinate
+* @param[out]	p_Y				- Pointer to y coordinate
+* @param[out]	p_force			- Pointer to pressure (force) of touch
+* @param[out]	p_is_pressed	- Pointer to pressed state
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_acquire_data(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_is_pressed)
+{
+	#if ( 1 == XPT2046_INJECT_EN )
+		xpt2046_inject_samp_t inj;
+
+		if ( true == xpt2046_inject_take( eXPT2046_INJECT_RAW, &inj ))
+		{
+			*p_X = inj.x;
+			*p_Y = inj.y;
+			*p_force = inj.force;
+			*p_is_pressed = inj.pressed;
+		}
+		else
+		{
+			xpt2046_read_data_from_controler( p_X, p_Y, p_force, p_is_pressed );
+		}
+	#else
+		xpt2046_read_data_from_controler( p_X, p_Y, p_force, p_is_pressed );
+	#endif
+}
+
+#if ( 1 == XPT2046_EVT_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Generate touch events
+	*
+	* @note		Injected events take precedence over touch data.
+	*
+	* @param[in]	is_cal	- Touch data is calibrated
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void xpt2046_gen_events(const bool is_cal)
+	{
+		#if ( 1 == XPT2046_INJECT_EN )
+			xpt2046_inject_samp_t inj;
+
+			if ( true == xpt2046_inject_take( eXPT2046_INJECT_EVT, &inj ))
+			{
+				xpt2046_evt_from_touch( inj.x, inj.y, inj.force, inj.pressed );
+			}
+			else if ( true == is_cal )
+			{
+				xpt2046_evt_from_touch( gp_touch->page, gp_touch->col, gp_touch->force, gp_touch->pressed );
+			}
+			else
+			{
+				// No actions...
+			}
+		#else
+			if ( true == is_cal )
+			{
+				xpt2046_evt_from_touch( gp_touch->page, gp_touch->col, gp_touch->force, gp_touch->pressed );
+			}
+		#endif
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read data from controller
+*
+* @param[out]	p_X				- Pointer to x coordinate
+* @param[out]	p_Y				- Pointer to y coordinate
+* @param[out]	p_force			- Pointer to pressure (force) of touch
+* @param[out]	p_is_pressed	- Pointer to pressed state
+* @return 		status			- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_read_data_from_controler(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_is_pressed)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	xpt2046_raw_t raw;
+
+	// Is pressed
+	// NOTE: Sleeping controller is not converting
+	if 	(	( false == gb_is_asleep )
+		&&	( true == gp_backend->pf_is_touched()))
+	{
+		*p_is_pressed = true;
+
+		// Sample at quietest interference phase
+		#if ( 1 == XPT2046_NOISE_EN )
+			xpt2046_noise_sync();
+		#endif
+
+		// Get X & Y position and pressure data
+		status = gp_backend->pf_acquire( &raw );
+
+		// NOTE: On transfer error previous sample is repeated
+		if ( eXPT2046_OK == status )
+		{
+			gp_hist->X_prev = raw.x;
+			gp_hist->Y_prev = raw.y;
+			gp_touch->motion = raw.motion;
+
+			// Calculate force
+			// NOTE: Zero when backend does not measure pressure
+			if ( true == gp_backend->pressure )
+			{
+				gp_hist->force_prev = xpt2046_calc_resistance( raw.x, raw.z1, raw.z2 );
+			}
+			else
+			{
+				gp_hist->force_prev = 0U;
+			}
+		}
+	}
+	else
+	{
+		*p_is_pressed = false;
+	}
+
+	// Return latest value
+	*p_X = gp_hist->X_prev;
+	*p_Y = gp_hist->Y_prev;
+	*p_force = gp_hist->force_prev;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Pen state handling
+*
+* @note		Release of pen is reported only after number of consecutive
+* 			released samples defined by processing profile. Position
+* 			is held at last pressed value meanwhile.
+*
+* @param[in,out]	p_is_pressed	- Pointer to pressed state
+* @return 			void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_pen_state(bool * const p_is_pressed)
+{
+	if ( true == *p_is_pressed )
+	{
+		gp_hist->release_cnt = 0;
+	}
+	else if	(	( true == gp_touch->pressed )
+			&&	( gp_hist->release_cnt < gp_profile->release_deb ))
+	{
+		gp_hist->release_cnt++;
+		*p_is_pressed = true;
+	}
+	else
+	{
+		// No actions...
+	}
+}
+
+#if ( 1 == XPT2046_CONF_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Calculate confidence of current sample
+	*
+	* @param[in]	is_live	- Pressed state before release debounce
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void xpt2046_confidence(const bool is_live)
+	{
+		xpt2046_conf_in_t in;
+
+		if 	(	( true == gp_touch->pressed )
+			&&	( false == gp_hist->pressed_prev ))
+		{
+			gp_hist->down_tick = XPT2046_GET_SYSTICK();
+		}
+
+		gp_hist->pressed_prev = gp_touch->pressed;
+
+		if ( true == gp_touch->pressed )
+		{
+			in.age_ms 	= (uint32_t)( XPT2046_GET_SYSTICK() - gp_hist->down_tick );
+			in.spread 	= gp_touch->motion;
+			in.live 	= is_live;
+
+			#if ( 1 == XPT2046_PRESSURE_EN )
+				in.pressure = ( true == gp_backend->pressure ) ? gp_touch->force : XPT2046_CONF_PRESSURE_NA;
+			#else
+				in.pressure = XPT2046_CONF_PRESSURE_NA;
+			#endif
+
+			gp_touch->conf = xpt2046_conf_calc( &in );
+		}
+		else
+		{
+			gp_touch->conf = 0;
+		}
+	}
+
+#endif // 1 == XPT2046_CONF_EN
+
+#if ( 1 == XPT2046_CLASS_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Classify contact and select processing profile
+	*
+	* @param[in]	X			- Raw X position
+	* @param[in]	Y			- Raw Y position
+	* @param[in]	force		- Raw touch resistance
+	* @param[in]	is_pressed	- Raw pressed state
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void xpt2046_classify(const uint16_t X, const uint16_t Y, const uint16_t force, const bool is_pressed)
+	{
+		if ( true == is_pressed )
+		{
+			// New contact
+			if ( false == gp_touch->pressed )
+			{
+				xpt2046_class_reset();
+			}
+
+			(void) xpt2046_class_add_sample( X, Y, force );
+		}
+
+		gp_profile = xpt2046_class_get_profile();
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate touch resistance
+*
+* @note		Touch resistance is inverse to pressure. Equation is
+* 			Rt = X/4096 * ( Z2/Z1 - 1 ), scaled by 4096 and
+* 			calculated in fixed point.
+*
+* @param[in]	X			- X position measurement
+* @param[in]	Z1			- Z1 measurement
+* @param[in]	Z2			- Z2 measurement
+* @return 		resistance	- Raw touch resistance
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_calc_resistance(const uint16_t X, const uint16_t Z1, const uint16_t Z2)
+{
+	uint32_t resistance;
+
+	if (( 0U == Z1 ) || ( Z2 <= Z1 ))
+	{
+		resistance = 0U;
+	}
+	else
+	{
+		resistance = ((uint32_t) X * (uint32_t)( Z2 - Z1 )) / Z1;
+
+		if ( resistance > UINT16_MAX )
+		{
+			resistance = UINT16_MAX;
+		}
+	}
+
+	return (uint16_t) resistance;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*			Filter touch data
+*
+* @note		Filter window and outlier limit are taken from processing
+* 			profile of current contact. Average is calculated as running
+* 			sum, thus cost is independent of window size.
+*
+* @param[out]	p_X		- Pointer to x coordinate
+* @param[out]	p_Y		- Pointer to y coordinate
+* @param[out]	p_force	- Pointer to pressure (force) of touch
+* @param[out]	p_touch	- Pointer to touch detected state
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_filter_data(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_touch)
+{
+	const uint8_t win_par = (uint8_t) xpt2046_par_get_value( eXPT2046_PAR_FILTER_WIN );
+	const uint8_t win = ( gp_profile->filt_win < win_par ) ? gp_profile->filt_win : win_par;
+	uint32_t i;
+
+	// New touch detected -> clear old samples
+	if 	(	( true == *p_touch )
+		&& 	( false == gp_filter->touch_prev ))
+	{
+		for ( i = 0; i < XPT2046_FILTER_WIN_SAMP; i++ )
+		{
+			gp_filter->x.samp_buf[i] = *p_X;
+			gp_filter->y.samp_buf[i] = *p_Y;
+			gp_filter->force.samp_buf[i] = *p_force;
+		}
+
+		gp_filter->x.sum = (uint32_t) *p_X * win;
+		gp_filter->y.sum = (uint32_t) *p_Y * win;
+		gp_filter->force.sum = (uint32_t) *p_force * win;
+		gp_filter->x.outlier_cnt = 0U;
+		gp_filter->y.outlier_cnt = 0U;
+		gp_filter->force.outlier_cnt = 0U;
+		gp_filter->win = win;
+	}
+
+	// Store touch
+	gp_filter->touch_prev = *p_touch;
+
+	// Profile changed window -> re-sum
+	if ( win != gp_filter->win )
+	{
+		gp_filter->win = win;
+		xpt2046_filter_resum( &gp_filter->x, gp_filter->idx, win );
+		xpt2046_filter_resum( &gp_filter->y, gp_filter->idx, win );
+		xpt2046_filter_resum( &gp_filter->force, gp_filter->idx, win );
+	}
+
+	// Filter each axis
+	*p_X = xpt2046_filter_axis( &gp_filter->x, *p_X, gp_filter->idx, win, gp_profile->outlier_lim );
+	*p_Y = xpt2046_filter_axis( &gp_filter->y, *p_Y, gp_filter->idx, win, gp_profile->outlier_lim );
+	*p_force = xpt2046_filter_axis( &gp_filter->force, *p_force, gp_filter->idx, win, UINT16_MAX );
+
+	// Increment sample index
+	gp_filter->idx++;
+
+	if ( gp_filter->idx >= XPT2046_FILTER_WIN_SAMP )
+	{
+		gp_filter->idx = 0;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*			Filter single axis
+*
+* @note		Single sample beyond outlier limit is taken as spike and
+* 			replaced by current average. XPT2046_FILTER_OUTLIER_NUM
+* 			consecutive such samples are taken as real move and window
+* 			is re-seeded with new position, so fast strokes are not
+* 			slew limited.
+*
+* @param[in]	p_filt		- Pointer to axis filter data
+* @param[in]	samp		- New sample
+* @param[in]	idx			- Sample buffer index
+* @param[in]	win			- Filter window in samples
+* @param[in]	outlier_lim	- Max. deviation of sample from current average
+* @return 		avg			- Filtered value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_filter_axis(xpt2046_filt_data_t * const p_filt, const uint16_t samp, const uint8_t idx, const uint8_t win, const uint16_t outlier_lim)
+{
+	const uint32_t avg = p_filt->sum / win;
+	uint32_t in = samp;
+	uint32_t old_idx;
+	uint32_t i;
+
+	if 	(	( in > ( avg + outlier_lim ))
+		||	(( in + outlier_lim ) < avg ))
+	{
+		p_filt->outlier_cnt++;
+	}
+	else
+	{
+		p_filt->outlier_cnt = 0U;
+	}
+
+	// Persistent outlier -> real move, restart at new position
+	if ( p_filt->outlier_cnt >= XPT2046_FILTER_OUTLIER_NUM )
+	{
+		for ( i = 0; i < XPT2046_FILTER_WIN_SAMP; i++ )
+		{
+			p_filt->samp_buf[i] = samp;
+		}
+
+		p_filt->sum = (uint32_t) samp * win;
+		p_filt->outlier_cnt = 0U;
+	}
+	else
+	{
+		// Single outlier -> drop spike
+		if ( p_filt->outlier_cnt > 0U )
+		{
+			in = avg;
+		}
+
+		// Remove sample leaving window and add new one
+		old_idx = ( idx + XPT2046_FILTER_WIN_SAMP - win ) % XPT2046_FILTER_WIN_SAMP;
+		p_filt->sum -= p_filt->samp_buf[ old_idx ];
+		p_filt->samp_buf[ idx ] = (uint16_t) in;
+		p_filt->sum += in;
+	}
+
+	return (uint16_t)( p_filt->sum / win );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*			Re-calculate axis filter sum for new window
+*
+* @param[in]	p_filt		- Pointer to axis filter data
+* @param[in]	idx			- Index of next sample
+* @param[in]	win			- Filter window in samples
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_filter_resum(xpt2046_filt_data_t * const p_filt, const uint8_t idx, const uint8_t win)
+{
+	uint32_t i;
+
+	p_filt->sum = 0;
+
+	for ( i = 1; i <= win; i++ )
+	{
+		p_filt->sum += p_filt->samp_buf[ ( idx + XPT2046_FILTER_WIN_SAMP - i ) % XPT2046_FILTER_WIN_SAMP ];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start calibration routine
 *
-* @param[out]	p_page 		- Pointer to page (x) coordinate
-* @param[out]	p_col 		- Pointer to column (y) coordinate
-* @param[out]	p_force 	- Pointer to pressure (force) of touch
-* @param[out]	p_pressed 	- Pointer to pressed flag
-* @return		status 		- Status of initialization
+* @return 	status - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-xpt2046_status_t xpt2046_get_touch(uint16_t * const p_page, uint16_t * const p_col, uint16_t * const p_force, bool * const p_pressed)
+xpt2046_status_t xpt2046_start_calibration(void)
 {
 	xpt2046_status_t status = eXPT2046_OK;
 
-	XPT2046_ASSERT( true == gb_is_init );
-
-	if ( NULL != p_page )
-	{
-		*p_page 	= g_touch.page;
-	}
-
-	if ( NULL != p_col )
+	if ( true == gb_is_init )
 	{
-		*p_col 		= g_touch.col;
+		#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+			if ( false == gp_cal_data->busy )
+			{
+				gp_cal_data->start = true;
+			}
+			else
+			{
+				status = eXPT2046_CAL_IN_PROGRESS;
+			}
+		#else
+			// Factory calibration only
+			status = eXPT2046_ERROR;
+		#endif
 	}
-
-	if ( NULL != p_force )
+	else
 	{
-		*p_force 	= g_touch.force;
-	}
+		status = eXPT2046_ERROR;
 
-	if ( NULL != p_pressed )
-	{
-		*p_pressed 	= g_touch.pressed;
+		XPT2046_LOG( eXPT2046_LOG_NOT_INIT, 0, 0 );
+		XPT2046_ASSERT( 0 );
 	}
 
 	return status;
@@ -275,196 +1436,118 @@ xpt2046_status_t xpt2046_get_touch(uint16_t * const p_page, uint16_t * const p_c
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Main touch controller handler
+*		Get active calibration factors
 *
-* @note 	Shall be called periodically every 10ms.
+* @note		Run-time factors take precedence over factory (baked) ones.
 *
-* @return 		void
+* @param[out]	p_is_runtime	- True if run-time factors are active
+* @return 		p_factors		- Pointer to active factors, NULL if not calibrated
 */
 ////////////////////////////////////////////////////////////////////////////////
-void xpt2046_hndl(void)
+static const int32_t * xpt2046_cal_get_active(bool * const p_is_runtime)
 {
-	uint16_t X;
-	uint16_t Y;
-	uint16_t force;
-	bool is_pressed;
+	const int32_t * p_factors = NULL;
+	bool is_runtime = false;
 
-	XPT2046_ASSERT( true == gb_is_init );
+	#if ( 1 == XPT2046_CAL_RUNTIME_EN )
 
-	// Get data
-	xpt2046_read_data_from_controler( &X, &Y, &force, &is_pressed );
+		uint8_t active;
+
+		if ( NULL != gp_cal_data )
+		{
+			// NOTE: Index is read before done flag, thus valid factors are never missed
+			active = gp_cal_data->active;
+
+			if ( true == gp_cal_data->done )
+			{
+				p_factors = (const int32_t*) &gp_cal_data->factors[ active ];
+				is_runtime = true;
+			}
+		}
 
-	// Apply filter
-	#if ( 1 == XPT2046_FILTER_EN )
-		xpt2046_filter_data( &X, &Y, &force, &is_pressed );
 	#endif
 
-	// Apply calibration
-	if ( g_cal_data.done )
-	{
-		xpt2046_calibrate_data( &X, &Y, (const int32_t*)&g_cal_data.factors );
-	}
+	#if ( 1 == XPT2046_CAL_BAKED_EN )
+		if ( NULL == p_factors )
+		{
+			p_factors = (const int32_t*) &gc_cal_baked_factors;
+		}
+	#endif
 
-	// Store
-	g_touch.page = X;
-	g_touch.col = Y;
-	g_touch.force = force;
-	g_touch.pressed = is_pressed;
+	*p_is_runtime = is_runtime;
 
-	// Calibration handler
-	xpt2046_cal_hndl();
+	return p_factors;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Read data from controller
+*		Get calibration routine busy flag
 *
-* @param[out]	p_X				- Pointer to x coordinate
-* @param[out]	p_Y				- Pointer to y coordinate
-* @param[out]	p_force			- Pointer to pressure (force) of touch
-* @param[out]	p_is_pressed	- Pointer to pressed state
-* @return 		status			- Status of operation
+* @return 		busy - True while calibration routine runs
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void xpt2046_read_data_from_controler(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_is_pressed)
+static bool xpt2046_cal_is_busy(void)
 {
-	xpt2046_status_t status = eXPT2046_OK;
-	uint16_t Z1;
-	uint16_t Z2;
-	static uint16_t X_prev;
-	static uint16_t Y_prev;
-	static uint16_t force_prev;
-
-	// Is pressed
-	if ( eXPT2046_INT_ON == xpt2046_low_if_get_int() )
-	{
-		*p_is_pressed = true;
-
-		// Get X & Y position
-		status |= xpt2046_low_if_exchange( eXPT2046_ADDR_X_POS, eXPT2046_PD_DEVICE_FULLY_ON, eXPT2046_START_ON, p_X );
-		status |= xpt2046_low_if_exchange( eXPT2046_ADDR_Y_POS, eXPT2046_PD_DEVICE_FULLY_ON, eXPT2046_START_ON, p_Y );
-
-		// Get pressure data
-		status |= xpt2046_low_if_exchange( eXPT2046_ADDR_Z1_POS, eXPT2046_PD_DEVICE_FULLY_ON, eXPT2046_START_ON, &Z1 );
-		status |= xpt2046_low_if_exchange( eXPT2046_ADDR_YN, eXPT2046_PD_VREF_ON, eXPT2046_START_ON, &Z2 );
+	bool busy = false;
 
-		if ( eXPT2046_OK == status )
+	#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+		if ( NULL != gp_cal_data )
 		{
-			// Calculate force
-			*p_force = (uint16_t) ((((float) *p_X / 4096.0f ) * (((float) Z2  / (float) Z1 ) - 1.0f )) * 4095.0f );
-
-			X_prev = *p_X;
-			Y_prev = *p_Y;
-			force_prev = *p_force;
+			busy = gp_cal_data->busy;
 		}
-	}
-	else
-	{
-		*p_is_pressed = false;
+	#endif
 
-		// Return old value
-		*p_X = X_prev;
-		*p_Y = Y_prev;
-		*p_force = force_prev;
-	}
+	return busy;
 }
 
+#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*			Get touch data
+*		Allocate calibration data
+*
+* @note		No factors are active until calibration is done or set.
 *
-* @param[out]	p_X		- Pointer to x coordinate
-* @param[out]	p_Y		- Pointer to y coordinate
-* @param[out]	p_force	- Pointer to pressure (force) of touch
-* @param[out]	p_touch	- Pointer to touch detected state
 * @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void xpt2046_filter_data(uint16_t * const p_X, uint16_t * const p_Y, uint16_t * const p_force, bool * const p_touch)
+static xpt2046_status_t xpt2046_alloc_cal_data(void)
 {
-	static xpt2046_filter_t filter;
-	static uint8_t samp_cnt = 0;
-	static bool touch_prev;
-	const uint16_t samp_N = XPT2046_FILTER_WIN_SAMP;
-	uint32_t i;
-
-	// New touch detected -> clear old samples
-	if 	(	( true == *p_touch )
-		&& 	( false == touch_prev ))
-	{
-		for ( i = 0; i < samp_N; i++ )
-		{
-			filter.x.samp_buf[i] = *p_X;
-			filter.y.samp_buf[i] = *p_Y;
-			filter.force.samp_buf[i] = *p_force;
-		}
-	}
-
-	// Store touch
-	touch_prev = *p_touch;
-
-	// Fill buffer
-	filter.x.samp_buf[ samp_cnt ] = *p_X;
-	filter.y.samp_buf[ samp_cnt ] = *p_Y;
-	filter.force.samp_buf[ samp_cnt ] = *p_force;
-
-	// Increment sample counter
-	if ( samp_cnt >= samp_N )
-	{
-		samp_cnt = 0;
-	}
-	else
-	{
-		samp_cnt++;
-	}
+	xpt2046_status_t status = eXPT2046_OK;
 
-	filter.x.sum = 0;
-	filter.y.sum = 0;
-	filter.force.sum = 0;
+	gp_cal_data = xpt2046_mem_alloc( sizeof( xpt2046_cal_data_t ));
 
-	// Sum
-	for ( i = 0; i < samp_N; i++ )
+	if ( NULL == gp_cal_data )
 	{
-		filter.x.sum += filter.x.samp_buf[i];
-		filter.y.sum += filter.y.samp_buf[i];
-		filter.force.sum += filter.force.samp_buf[i];
+		status = eXPT2046_ERROR;
 	}
 
-	// Average
-	*p_X = (uint16_t) (filter.x.sum / samp_N );
-	*p_Y = (uint16_t) (filter.y.sum / samp_N );
-	*p_force = (uint16_t) (filter.force.sum / samp_N );
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Start calibration routine
+*		Allocate and initialize calibration FSM
 *
-* @return 	status - Status of operation
+* @return 		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-xpt2046_status_t xpt2046_start_calibration(void)
+static xpt2046_status_t xpt2046_alloc_cal_fsm(void)
 {
 	xpt2046_status_t status = eXPT2046_OK;
 
-	if ( true == gb_is_init )
+	gp_cal_fsm = xpt2046_mem_alloc( sizeof( xpt2046_fsm_t ));
+
+	if ( NULL != gp_cal_fsm )
 	{
-		if ( false == g_cal_data.busy )
-		{
-			g_cal_data.start = true;
-			g_cal_data.done = false;
-		}
-		else
-		{
-			status = eXPT2046_CAL_IN_PROGRESS;
-		}
+		gp_cal_fsm->state.cur = eXPT2046_FSM_NORMAL;
+		gp_cal_fsm->state.next = eXPT2046_FSM_NORMAL;
+		gp_cal_fsm->time.duration = 0;
+		gp_cal_fsm->time.first_entry = false;
 	}
 	else
 	{
 		status = eXPT2046_ERROR;
-
-		XPT2046_DBG_PRINT( "Module not initialized!" );
-		XPT2046_ASSERT( 0 );
 	}
 
 	return status;
@@ -484,7 +1567,7 @@ static void xpt2046_cal_hndl(void)
 {
 	xpt2046_fms_manager();
 
-	switch( g_cal_fsm.state.cur )
+	switch( gp_cal_fsm->state.cur )
 	{
 		case eXPT2046_FSM_NORMAL:
 			xpt2046_fsm_normal();
@@ -509,7 +1592,7 @@ static void xpt2046_cal_hndl(void)
 		default:
 			xpt2046_fsm_normal();
 
-			XPT2046_DBG_PRINT( "Invalid FSM state..." );
+			XPT2046_LOG( eXPT2046_LOG_FSM_INVALID, gp_cal_fsm->state.cur, 0 );
 			XPT2046_ASSERT( 0 );
 			break;
 	}
@@ -524,23 +1607,21 @@ static void xpt2046_cal_hndl(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_fms_manager(void)
 {
-	static uint32_t tick = 0;
-
-	//if ( state_prev != g_cal_fsm.state.cur )
-	if ( g_cal_fsm.state.cur != g_cal_fsm.state.next )
+	//if ( state_prev != gp_cal_fsm->state.cur )
+	if ( gp_cal_fsm->state.cur != gp_cal_fsm->state.next )
 	{
-		g_cal_fsm.state.cur = g_cal_fsm.state.next;
-		g_cal_fsm.time.duration = 0;
-		g_cal_fsm.time.first_entry = true;
+		gp_cal_fsm->state.cur = gp_cal_fsm->state.next;
+		gp_cal_fsm->time.duration = 0;
+		gp_cal_fsm->time.first_entry = true;
 	}
 	else
 	{
-		g_cal_fsm.time.duration += (uint32_t) ( HAL_GetTick() - tick );
-		g_cal_fsm.time.duration = XPT2046_LIMIT_FMS_DURATION( g_cal_fsm.time.duration );
-		g_cal_fsm.time.first_entry = false;
+		gp_cal_fsm->time.duration += (uint32_t) ( XPT2046_GET_SYSTICK() - gp_cal_fsm->time.tick );
+		gp_cal_fsm->time.duration = XPT2046_LIMIT_FMS_DURATION( gp_cal_fsm->time.duration );
+		gp_cal_fsm->time.first_entry = false;
 	}
 
-	tick = HAL_GetTick();
+	gp_cal_fsm->time.tick = XPT2046_GET_SYSTICK();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -552,12 +1633,23 @@ static void xpt2046_fms_manager(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_fsm_normal(void)
 {
-	if ( true == g_cal_data.start )
+	uint32_t px;
+
+	if ( true == gp_cal_data->start )
 	{
-		g_cal_data.start = false;
-		g_cal_data.busy = true;
+		gp_cal_data->start = false;
+		gp_cal_data->busy = true;
+
+		XPT2046_LOG( eXPT2046_LOG_CAL_START, 0, 0 );
+
+		// Load display points
+		for ( px = 0; px < eXPT2046_CAL_P_NUM_OF; px++ )
+		{
+			gp_cal_data->Dp[ px ].x = xpt2046_par_get_value((xpt2046_par_id_t)( eXPT2046_PAR_CAL_P1_X + ( 2U * px )));
+			gp_cal_data->Dp[ px ].y = xpt2046_par_get_value((xpt2046_par_id_t)( eXPT2046_PAR_CAL_P1_Y + ( 2U * px )));
+		}
 
-		g_cal_fsm.state.next = eXPT2046_FSM_P1_ACQ;
+		gp_cal_fsm->state.next = eXPT2046_FSM_P1_ACQ;
 	}
 }
 
@@ -570,26 +1662,28 @@ static void xpt2046_fsm_normal(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_fsm_p1_acq(void)
 {
-	static bool point_touched = false;
-
-	if ( true == g_cal_fsm.time.first_entry )
+	if ( true == gp_cal_fsm->time.first_entry )
 	{
-		// Clear display
-		ili9488_set_background( eILI9488_COLOR_BLACK );
+		#if ( 1 == XPT2046_CAL_GUI_EN )
+
+			// Clear display
+			ili9488_set_background( eILI9488_COLOR_BLACK );
+
+		#endif
 
 		// Set up P1
 		xpt2046_set_cal_point( eXPT2046_CAL_P1 );
 
-		point_touched = false;
+		gp_cal_fsm->point_touched = false;
 	}
 	else
 	{
 		// Wait for first touch
-		if ( false == point_touched )
+		if ( false == gp_cal_fsm->point_touched )
 		{
-			if ( true == g_touch.pressed )
+			if ( true == gp_touch->pressed )
 			{
-				point_touched = true;
+				gp_cal_fsm->point_touched = true;
 			}
 		}
 
@@ -597,13 +1691,13 @@ static void xpt2046_fsm_p1_acq(void)
 		else
 		{
 			// Acquire data
-			g_cal_data.Tp[0].x = g_touch.page;
-			g_cal_data.Tp[0].y = g_touch.col;
+			gp_cal_data->Tp[0].x = gp_touch->raw_x;
+			gp_cal_data->Tp[0].y = gp_touch->raw_y;
 
 			// Wait for release
-			if ( false == g_touch.pressed )
+			if ( false == gp_touch->pressed )
 			{
-				g_cal_fsm.state.next = eXPT2046_FSM_P2_ACQ;
+				gp_cal_fsm->state.next = eXPT2046_FSM_P2_ACQ;
 
 				// Clear P1
 				xpt2046_clear_cal_point( eXPT2046_CAL_P1 );
@@ -621,23 +1715,21 @@ static void xpt2046_fsm_p1_acq(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_fsm_p2_acq(void)
 {
-	static bool point_touched = false;
-
-	if ( true == g_cal_fsm.time.first_entry )
+	if ( true == gp_cal_fsm->time.first_entry )
 	{
 		// Set up P2
 		xpt2046_set_cal_point( eXPT2046_CAL_P2 );
 
-		point_touched = false;
+		gp_cal_fsm->point_touched = false;
 	}
 	else
 	{
 		// Wait for first touch
-		if ( false == point_touched )
+		if ( false == gp_cal_fsm->point_touched )
 		{
-			if ( true == g_touch.pressed )
+			if ( true == gp_touch->pressed )
 			{
-				point_touched = true;
+				gp_cal_fsm->point_touched = true;
 			}
 		}
 
@@ -645,13 +1737,13 @@ static void xpt2046_fsm_p2_acq(void)
 		else
 		{
 			// Acquire data
-			g_cal_data.Tp[1].x = g_touch.page;
-			g_cal_data.Tp[1].y = g_touch.col;
+			gp_cal_data->Tp[1].x = gp_touch->raw_x;
+			gp_cal_data->Tp[1].y = gp_touch->raw_y;
 
 			// Wait for release
-			if ( false == g_touch.pressed )
+			if ( false == gp_touch->pressed )
 			{
-				g_cal_fsm.state.next = eXPT2046_FSM_P3_ACQ;
+				gp_cal_fsm->state.next = eXPT2046_FSM_P3_ACQ;
 
 				// Clear point
 				xpt2046_clear_cal_point( eXPT2046_CAL_P2 );
@@ -669,23 +1761,21 @@ static void xpt2046_fsm_p2_acq(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_fsm_p3_acq(void)
 {
-	static bool point_touched = false;
-
-	if ( true == g_cal_fsm.time.first_entry )
+	if ( true == gp_cal_fsm->time.first_entry )
 	{
 		// Set up P3
 		xpt2046_set_cal_point( eXPT2046_CAL_P3 );
 
-		point_touched = false;
+		gp_cal_fsm->point_touched = false;
 	}
 	else
 	{
 		// Wait for first touch
-		if ( false == point_touched )
+		if ( false == gp_cal_fsm->point_touched )
 		{
-			if ( true == g_touch.pressed )
+			if ( true == gp_touch->pressed )
 			{
-				point_touched = true;
+				gp_cal_fsm->point_touched = true;
 			}
 		}
 
@@ -693,13 +1783,13 @@ static void xpt2046_fsm_p3_acq(void)
 		else
 		{
 			// Acquire data
-			g_cal_data.Tp[2].x = g_touch.page;
-			g_cal_data.Tp[2].y = g_touch.col;
+			gp_cal_data->Tp[2].x = gp_touch->raw_x;
+			gp_cal_data->Tp[2].y = gp_touch->raw_y;
 
 			// Wait for release
-			if ( false == g_touch.pressed )
+			if ( false == gp_touch->pressed )
 			{
-				g_cal_fsm.state.next = eXPT2046_FSM_CALC_FACTORS;
+				gp_cal_fsm->state.next = eXPT2046_FSM_CALC_FACTORS;
 
 				// Clear point
 				xpt2046_clear_cal_point( eXPT2046_CAL_P3 );
@@ -717,60 +1807,155 @@ static void xpt2046_fsm_p3_acq(void)
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_fsm_calc_factors(void)
 {
-	int32_t cal_factors[7];
+	int32_t cal_factors[ XPT2046_CAL_FACTORS_NUM ];
 
 	// Calculate calibration data
-	xpt2046_calculate_factors( (int32_t*) &cal_factors, (const xpt2046_point_t*) &g_cal_data.Dp, (const xpt2046_point_t*) &g_cal_data.Tp );
+	xpt2046_calculate_factors( (int32_t*) &cal_factors, (const xpt2046_point_t*) &gp_cal_data->Dp, (const xpt2046_point_t*) &gp_cal_data->Tp );
 
-	// Store
-	memcpy( g_cal_data.factors, cal_factors, sizeof( cal_factors ));
+	// Switch to new factors
+	// NOTE: FSM runs at end of handler cycle, thus switch can be done at once
+	xpt2046_cal_commit( cal_factors );
+	xpt2046_cal_take_pending();
+
+	XPT2046_LOG( eXPT2046_LOG_CAL_DONE, cal_factors[0], 0 );
 
 	// Go to normal
-	g_cal_fsm.state.next = eXPT2046_FSM_NORMAL;
+	gp_cal_fsm->state.next = eXPT2046_FSM_NORMAL;
 
 	// Manage flags
-	g_cal_data.busy = false;
-	g_cal_data.done = true;
+	gp_cal_data->busy = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Commit new calibration factors
+*
+* @note		Factors are only written to pending buffer, touch handler
+* 			switches to them at start of next cycle. Any number of commits
+* 			per handler period is supported, last one wins. Commits shall
+* 			not preempt each other.
+*
+* @param[in] 	p_factors	- Pointer to new factors
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_cal_commit(const int32_t * const p_factors)
+{
+	uint32_t i;
+
+	// Odd sequence marks write in progress
+	gp_cal_data->seq++;
+
+	for ( i = 0; i < XPT2046_CAL_FACTORS_NUM; i++ )
+	{
+		gp_cal_data->pending[i] = p_factors[i];
+	}
+
+	gp_cal_data->seq++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Switch to pending calibration factors
+*
+* @note		Called by touch handler only, thus inactive buffer is never
+* 			in use while it is written. Factors are copied and then become
+* 			active by single byte write of active index. When commit
+* 			interrupts the copy, switch is retried on next cycle.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_cal_take_pending(void)
+{
+	uint32_t seq;
+	uint8_t next;
+	uint32_t i;
+
+	if ( NULL != gp_cal_data )
+	{
+		seq = gp_cal_data->seq;
+
+		if 	(	( seq != gp_cal_data->seq_taken )
+			&&	( 0U == ( seq & 1U )))
+		{
+			next = ( gp_cal_data->active ^ 1U );
+
+			for ( i = 0; i < XPT2046_CAL_FACTORS_NUM; i++ )
+			{
+				gp_cal_data->factors[ next ][i] = gp_cal_data->pending[i];
+			}
+
+			// Switch only if no commit came in meantime
+			if ( seq == gp_cal_data->seq )
+			{
+				gp_cal_data->seq_taken = seq;
+				gp_cal_data->active = next;
+				gp_cal_data->done = true;
+
+				// Re-map active regions
+				#if ( 1 == XPT2046_ROI_EN )
+					xpt2046_roi_invalidate();
+				#endif
+			}
+		}
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Set (draw) calibration point
 *
+* @note		Nothing is drawn when calibration GUI is disabled.
+*
 * @param[in]	px	- Calibration point number
 * @return 		void
 */
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_set_cal_point(const xpt2046_points_t px)
 {
-	if ( px < eXPT2046_CAL_P_NUM_OF )
-	{
-		g_cal_circ_attr.position.start_page = g_cal_data.Dp[ px ].x;
-		g_cal_circ_attr.position.start_col 	= g_cal_data.Dp[ px ].y;
-		g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_FG;
-		ili9488_draw_circle( &g_cal_circ_attr );
-	}
+	#if ( 1 == XPT2046_CAL_GUI_EN )
+
+		if ( px < eXPT2046_CAL_P_NUM_OF )
+		{
+			g_cal_circ_attr.position.start_page = gp_cal_data->Dp[ px ].x;
+			g_cal_circ_attr.position.start_col 	= gp_cal_data->Dp[ px ].y;
+			g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_FG;
+			ili9488_draw_circle( &g_cal_circ_attr );
+		}
+
+	#else
+		(void) px;
+	#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Clear calibration point
 *
+* @note		Nothing is drawn when calibration GUI is disabled.
+*
 * @param[in]	px	- Calibration point number
 * @return 		void
 */
 ////////////////////////////////////////////////////////////////////////////////
 static void xpt2046_clear_cal_point(const xpt2046_points_t px)
 {
-	if ( px < eXPT2046_CAL_P_NUM_OF )
-	{
-		//ili9488_fill_rectangle( g_cal_data.Dp[ px ].x, g_cal_data.Dp[ px ].y, XPT2046_POINT_SIZE, XPT2046_POINT_SIZE, XPT2046_POINT_COLOR_BG );
+	#if ( 1 == XPT2046_CAL_GUI_EN )
 
-		g_cal_circ_attr.position.start_page = g_cal_data.Dp[ px ].x;
-		g_cal_circ_attr.position.start_col 	= g_cal_data.Dp[ px ].y;
-		g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_BG;
-		ili9488_draw_circle( &g_cal_circ_attr );
-	}
+		if ( px < eXPT2046_CAL_P_NUM_OF )
+		{
+			//ili9488_fill_rectangle( gp_cal_data->Dp[ px ].x, gp_cal_data->Dp[ px ].y, XPT2046_POINT_SIZE, XPT2046_POINT_SIZE, XPT2046_POINT_COLOR_BG );
+
+			g_cal_circ_attr.position.start_page = gp_cal_data->Dp[ px ].x;
+			g_cal_circ_attr.position.start_col 	= gp_cal_data->Dp[ px ].y;
+			g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_BG;
+			ili9488_draw_circle( &g_cal_circ_attr );
+		}
+
+	#else
+		(void) px;
+	#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -843,6 +2028,44 @@ static void xpt2046_calibrate_data(uint16_t * const p_X, uint16_t * const p_Y, c
 	*p_Y = (uint16_t) Dp.y;
 }
 
+#endif // 1 == XPT2046_CAL_RUNTIME_EN
+
+#if ( 1 == XPT2046_CAL_BAKED_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calibrate raw touch data with factory (baked) factors
+*
+* @note		Factors are compile time constants, thus only multiply,
+* 			add and shift remain.
+*
+* @param[in] 	p_X			- Pointer to x coordinate
+* @param[in] 	p_Y			- Pointer to y coordinate
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_calibrate_baked(uint16_t * const p_X, uint16_t * const p_Y)
+{
+	const int32_t Tx = (int32_t) *p_X;
+	const int32_t Ty = (int32_t) *p_Y;
+	int32_t Dx;
+	int32_t Dy;
+
+	// Apply factors
+	Dx = (( (int32_t) XPT2046_CAL_BAKED_KXX * Tx ) + ( (int32_t) XPT2046_CAL_BAKED_KXY * Ty ) + (int32_t) XPT2046_CAL_BAKED_KX0 );
+	Dy = (( (int32_t) XPT2046_CAL_BAKED_KYX * Tx ) + ( (int32_t) XPT2046_CAL_BAKED_KYY * Ty ) + (int32_t) XPT2046_CAL_BAKED_KY0 );
+
+	// Back to pixels, negative values are limited to 0 anyway
+	Dx = ( Dx > 0 ) ? ( Dx >> XPT2046_CAL_BAKED_Q ) : 0;
+	Dy = ( Dy > 0 ) ? ( Dy >> XPT2046_CAL_BAKED_Q ) : 0;
+
+	// Return limited values
+	*p_X = (uint16_t) xpt2046_limit_cal_X_data( Dx );
+	*p_Y = (uint16_t) xpt2046_limit_cal_Y_data( Dy );
+}
+
+#endif // 1 == XPT2046_CAL_BAKED_EN
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Limit X calibration coordinate
@@ -853,15 +2076,16 @@ static void xpt2046_calibrate_data(uint16_t * const p_X, uint16_t * const p_Y, c
 ////////////////////////////////////////////////////////////////////////////////
 static int32_t xpt2046_limit_cal_X_data(const int32_t unlimited_data)
 {
+	const int32_t max = xpt2046_par_get_value( eXPT2046_PAR_DISPLAY_MAX_X );
 	int32_t lim_data;
 
 	if ( unlimited_data < 0 )
 	{
 		lim_data = 0;
 	}
-	else if ( unlimited_data > XPT2046_DISPLAY_MAX_X )
+	else if ( unlimited_data > max )
 	{
-		lim_data = XPT2046_DISPLAY_MAX_X;
+		lim_data = max;
 	}
 	else
 	{
@@ -881,15 +2105,16 @@ static int32_t xpt2046_limit_cal_X_data(const int32_t unlimited_data)
 ////////////////////////////////////////////////////////////////////////////////
 static int32_t xpt2046_limit_cal_Y_data(const int32_t unlimited_data)
 {
+	const int32_t max = xpt2046_par_get_value( eXPT2046_PAR_DISPLAY_MAX_Y );
 	int32_t lim_data;
 
 	if ( unlimited_data < 0 )
 	{
 		lim_data = 0;
 	}
-	else if ( unlimited_data > XPT2046_DISPLAY_MAX_Y )
+	else if ( unlimited_data > max )
 	{
-		lim_data = XPT2046_DISPLAY_MAX_Y;
+		lim_data = max;
 	}
 	else
 	{
@@ -903,18 +2128,29 @@ static int32_t xpt2046_limit_cal_Y_data(const int32_t unlimited_data)
 /**
 *		Get calibration done flag
 *
+* @note		Stays set during re-calibration as previous factors remain
+* 			active until new ones are committed. Always set with factory
+* 			(baked) calibration. Factors set by xpt2046_set_cal_factors()
+* 			count only once touch handler has switched to them.
+*
 * @return 	calibration done
 */
 ////////////////////////////////////////////////////////////////////////////////
 bool xpt2046_is_calibrated(void)
 {
-	return g_cal_data.done;
+	bool is_runtime;
+
+	return ( NULL != xpt2046_cal_get_active( &is_runtime ));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Set calibration factors
 *
+* @note		Overrides factory (baked) calibration. Ignored when run-time
+* 			override is disabled. Can be called from any context, factors
+* 			take effect at start of next touch handler cycle.
+*
 * @param[in] 	p_factors	- Pointer to factors
 * @return 		status 		- Status of operation
 */
@@ -922,23 +2158,103 @@ bool xpt2046_is_calibrated(void)
 void xpt2046_set_cal_factors(const int32_t * const p_factors)
 {
 	// Calibration already done some time in past
-	g_cal_data.done = true;
+	#if ( 1 == XPT2046_CAL_RUNTIME_EN )
+		if ( NULL != gp_cal_data )
+		{
+			xpt2046_cal_commit( p_factors );
 
-	// Copy factors
-	memcpy( &g_cal_data.factors, p_factors, sizeof( g_cal_data.factors ));
+			XPT2046_LOG( eXPT2046_LOG_CAL_SET, p_factors[0], 0 );
+		}
+	#else
+		(void) p_factors;
+	#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Get calibration factors
 *
-* @param[out] 	p_factors	- Pointer to factors
+* @note		Copies active factors. Output is left untouched until calibrated.
+* 			Factors set by xpt2046_set_cal_factors() are returned after
+* 			next touch handler cycle.
+*
+* @param[out] 	p_factors	- Pointer to 7 factors
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_get_cal_factors(int32_t * const p_factors)
+{
+	bool is_runtime;
+	const int32_t * const p_active = xpt2046_cal_get_active( &is_runtime );
+
+	if ( NULL != p_active )
+	{
+		memcpy( p_factors, p_active, ( XPT2046_CAL_FACTORS_NUM * sizeof( int32_t )));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set calibration record
+*
+* @note		Restores calibration factors (see xpt2046_set_cal_factors())
+* 			together with SPI clock setting of eXPT2046_PAR_SPI_CLK. Both
+* 			take effect at start of next touch handler cycle. Nothing is
+* 			restored if clock setting is out of range.
+*
+* @param[in] 	p_rec		- Pointer to calibration record
 * @return 		status 		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-void xpt2046_get_cal_factors(const int32_t * p_factors)
+xpt2046_status_t xpt2046_set_cal_record(const xpt2046_cal_rec_t * const p_rec)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+
+	if ( NULL != p_rec )
+	{
+		status = xpt2046_par_set( eXPT2046_PAR_SPI_CLK, (int32_t) p_rec->spi_clk );
+
+		if ( eXPT2046_OK == status )
+		{
+			xpt2046_set_cal_factors( p_rec->factors );
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get calibration record
+*
+* @note		Copies active factors and last set SPI clock setting (e.g.
+* 			tuned by xpt2046_clk_tune()), so that both can be stored to
+* 			NVM together and later restored with xpt2046_set_cal_record().
+*
+* @param[out] 	p_rec		- Pointer to calibration record
+* @return 		status 		- eXPT2046_ERROR if not calibrated
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_get_cal_record(xpt2046_cal_rec_t * const p_rec)
 {
-	p_factors = (int32_t*) &g_cal_data.factors;
+	xpt2046_status_t status = eXPT2046_ERROR;
+	bool is_runtime;
+	const int32_t * const p_active = xpt2046_cal_get_active( &is_runtime );
+	int32_t spi_clk;
+
+	if 	(	( NULL != p_rec )
+		&&	( NULL != p_active ))
+	{
+		status = xpt2046_par_get( eXPT2046_PAR_SPI_CLK, &spi_clk );
+
+		if ( eXPT2046_OK == status )
+		{
+			memcpy( p_rec->factors, p_active, sizeof( p_rec->factors ));
+			p_rec->spi_clk = (uint8_t) spi_clk;
+		}
+	}
+
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -36,8 +36,8 @@
  * 	Module version
  */
 #define XPT2046_VER_MAJOR		( 1 )
-#define XPT2046_VER_MINOR		( 0 )
-#define XPT2046_VER_DEVELOP		( 1 )
+#define XPT2046_VER_MINOR		( 1 )
+#define XPT2046_VER_DEVELOP		( 0 )
 
 // General status
 typedef enum
@@ -47,6 +47,40 @@ typedef enum
 	eXPT2046_CAL_IN_PROGRESS,
 } xpt2046_status_t;
 
+/**
+ * 	Number of calibration factors
+ */
+#define XPT2046_CAL_FACTORS_NUM		( 7U )
+
+/**
+ * 	Calibration record
+ *
+ * 	NOTE: SPI clock is tuned on same panel and wiring as calibration,
+ * 	thus it is stored and restored together with factors.
+ */
+typedef struct
+{
+	int32_t	factors[ XPT2046_CAL_FACTORS_NUM ];	// Calibration factors
+	uint8_t	spi_clk;							// SPI clock setting, 0 is slowest
+} xpt2046_cal_rec_t;
+
+/**
+ * 	Touch handler pipeline stages
+ *
+ * 	NOTE: Passed to XPT2046_PROF_BEGIN/END hooks.
+ */
+typedef enum
+{
+	eXPT2046_PROF_ACQUIRE = 0,		// Controller read (burst, validity)
+	eXPT2046_PROF_CONTACT,			// Region check, classification, release debounce
+	eXPT2046_PROF_FILTER,			// Filter and stationary lock
+	eXPT2046_PROF_CALIBRATE,		// Raw to display coordinates
+	eXPT2046_PROF_OUTPUT,			// Pressure, confidence, ink, heatmap
+	eXPT2046_PROF_EVENTS,			// Event generation
+
+	eXPT2046_PROF_NUM_OF,
+} xpt2046_prof_stage_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
@@ -55,9 +89,16 @@ bool				xpt2046_is_init					(void);
 void 				xpt2046_hndl					(void);
 
 xpt2046_status_t 	xpt2046_get_touch				(uint16_t * const p_page, uint16_t * const p_col, uint16_t * const p_force, bool * const p_pressed);
+xpt2046_status_t	xpt2046_get_touch_resistance	(uint16_t * const p_resistance);
+xpt2046_status_t	xpt2046_get_burst_motion		(uint16_t * const p_motion);
+xpt2046_status_t	xpt2046_get_confidence			(uint8_t * const p_conf);
 xpt2046_status_t 	xpt2046_start_calibration		(void);
 bool				xpt2046_is_calibrated			(void);
 void				xpt2046_set_cal_factors			(const int32_t * const p_factors);
-void				xpt2046_get_cal_factors			(const int32_t * p_factors);
+void				xpt2046_get_cal_factors			(int32_t * const p_factors);
+xpt2046_status_t	xpt2046_set_cal_record			(const xpt2046_cal_rec_t * const p_rec);
+xpt2046_status_t	xpt2046_get_cal_record			(xpt2046_cal_rec_t * const p_rec);
+xpt2046_status_t	xpt2046_sleep_enter				(void);
+xpt2046_status_t	xpt2046_sleep_exit				(void);
 
 #endif // _XPT2046_H_
@@ -0,0 +1,451 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_backend.c
+*@brief     Resistive touch controller backends
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BACKEND
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Resistive touch controller backends.
+*
+* 	Touch pipeline talks to controller only through backend. Built-in
+* 	backends cover controllers with XPT2046 compatible control byte
+* 	(ADS7843 family) and differ in channel map and power down bits. Other
+* 	controllers can be supported by providing own xpt2046_backend_t and
+* 	selecting it with XPT2046_BACKEND.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_backend.h"
+#include "xpt2046_low_if.h"
+#include "../../xpt2046_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Acquisition burst conversions
+// NOTE: Symmetric burst repeats Y and X in reverse order, thus all
+// channels are centred to the same instant
+typedef enum
+{
+	eXPT2046_ACQ_X = 0,
+	eXPT2046_ACQ_Y,
+	eXPT2046_ACQ_Z1,
+	eXPT2046_ACQ_Z2,
+
+	#if ( 1 == XPT2046_SYM_BURST_EN )
+		eXPT2046_ACQ_Y2,
+		eXPT2046_ACQ_X2,
+	#endif
+
+	XPT2046_ACQ_BURST_NUM,
+} xpt2046_acq_t;
+
+// ADS7843 acquisition burst conversions (no pressure)
+typedef enum
+{
+	eXPT2046_ACQ_ADS7843_X = 0,
+	eXPT2046_ACQ_ADS7843_Y,
+
+	#if ( 1 == XPT2046_SYM_BURST_EN )
+		eXPT2046_ACQ_ADS7843_Y2,
+		eXPT2046_ACQ_ADS7843_X2,
+	#endif
+
+	XPT2046_ACQ_BURST_NUM_ADS7843,
+} xpt2046_acq_ads7843_t;
+
+// Channel not available
+#define XPT2046_ADDR_NONE					( eXPT2046_ADDR_NUM_OF )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// XPT2046/TSC2046 acquisition burst
+// NOTE: Last conversion leaves ADC off and reference on with PENIRQ enabled
+static const xpt2046_low_if_cmd_t g_acq_burst_xpt2046[ XPT2046_ACQ_BURST_NUM ] =
+{
+	#if ( 1 == XPT2046_SYM_BURST_EN )
+		[ eXPT2046_ACQ_X ]	= { .addr = eXPT2046_ADDR_X_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_Y ]	= { .addr = eXPT2046_ADDR_Y_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_Z1 ]	= { .addr = eXPT2046_ADDR_Z1_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_Z2 ]	= { .addr = eXPT2046_ADDR_YN, 		.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_Y2 ]	= { .addr = eXPT2046_ADDR_Y_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_X2 ]	= { .addr = eXPT2046_ADDR_X_POS, 	.pd_mode = eXPT2046_PD_VREF_ON, .single_ended = false },
+	#else
+		[ eXPT2046_ACQ_X ]	= { .addr = eXPT2046_ADDR_X_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_Y ]	= { .addr = eXPT2046_ADDR_Y_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_Z1 ]	= { .addr = eXPT2046_ADDR_Z1_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_Z2 ]	= { .addr = eXPT2046_ADDR_YN, 		.pd_mode = eXPT2046_PD_VREF_ON, .single_ended = false },
+	#endif
+};
+
+// ADS7843 acquisition burst
+// NOTE: PD = 10 is reserved on ADS7843, thus power down with PENIRQ enabled
+static const xpt2046_low_if_cmd_t g_acq_burst_ads7843[ XPT2046_ACQ_BURST_NUM_ADS7843 ] =
+{
+	#if ( 1 == XPT2046_SYM_BURST_EN )
+		[ eXPT2046_ACQ_ADS7843_X ]	= { .addr = eXPT2046_ADDR_X_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_ADS7843_Y ]	= { .addr = eXPT2046_ADDR_Y_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_ADS7843_Y2 ]	= { .addr = eXPT2046_ADDR_Y_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_ADS7843_X2 ]	= { .addr = eXPT2046_ADDR_X_POS, 	.pd_mode = eXPT2046_PD_POWER_DOWN, .single_ended = false },
+	#else
+		[ eXPT2046_ACQ_ADS7843_X ]	= { .addr = eXPT2046_ADDR_X_POS, 	.pd_mode = eXPT2046_PD_DEVICE_FULLY_ON, .single_ended = false },
+		[ eXPT2046_ACQ_ADS7843_Y ]	= { .addr = eXPT2046_ADDR_Y_POS, 	.pd_mode = eXPT2046_PD_POWER_DOWN, .single_ended = false },
+	#endif
+};
+
+// Auxiliary channel addresses
+static const xpt2046_addr_t g_aux_addr_xpt2046[ eXPT2046_AUX_NUM_OF ] =
+{
+	[ eXPT2046_AUX_TEMP_0 ]	= eXPT2046_ADDR_TEMP_0,
+	[ eXPT2046_AUX_TEMP_1 ]	= eXPT2046_ADDR_TEMP_1,
+	[ eXPT2046_AUX_VBAT ]	= eXPT2046_ADDR_VBAT,
+	[ eXPT2046_AUX_IN ]		= eXPT2046_ADDR_AUX_IN,
+};
+
+static const xpt2046_addr_t g_aux_addr_ads7843[ eXPT2046_AUX_NUM_OF ] =
+{
+	[ eXPT2046_AUX_TEMP_0 ]	= XPT2046_ADDR_NONE,
+	[ eXPT2046_AUX_TEMP_1 ]	= XPT2046_ADDR_NONE,
+	[ eXPT2046_AUX_VBAT ]	= eXPT2046_ADDR_VBAT,		// IN3
+	[ eXPT2046_AUX_IN ]		= eXPT2046_ADDR_AUX_IN,		// IN4
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t	xpt2046_backend_init				(void);
+static bool				xpt2046_backend_is_touched			(void);
+static xpt2046_status_t	xpt2046_backend_set_power			(const xpt2046_power_t mode);
+static xpt2046_status_t	xpt2046_backend_read_aux			(const xpt2046_addr_t addr, const xpt2046_pd_t pd_mode, uint16_t * const p_val);
+
+#if ( 1 == XPT2046_SYM_BURST_EN )
+	static void			xpt2046_backend_sym_merge			(const uint16_t x1, const uint16_t y1, const uint16_t y2, const uint16_t x2, xpt2046_raw_t * const p_raw);
+#endif
+
+static xpt2046_status_t	xpt2046_backend_xpt2046_acquire		(xpt2046_raw_t * const p_raw);
+static xpt2046_status_t	xpt2046_backend_xpt2046_read_aux	(const xpt2046_aux_t ch, uint16_t * const p_val);
+
+static xpt2046_status_t	xpt2046_backend_ads7843_acquire		(xpt2046_raw_t * const p_raw);
+static xpt2046_status_t	xpt2046_backend_ads7843_set_power	(const xpt2046_power_t mode);
+static xpt2046_status_t	xpt2046_backend_ads7843_read_aux	(const xpt2046_aux_t ch, uint16_t * const p_val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Backends
+////////////////////////////////////////////////////////////////////////////////
+
+// XPT2046
+const xpt2046_backend_t g_xpt2046_backend_xpt2046 =
+{
+	.pf_init		= xpt2046_backend_init,
+	.pf_acquire		= xpt2046_backend_xpt2046_acquire,
+	.pf_set_power	= xpt2046_backend_set_power,
+	.pf_is_touched	= xpt2046_backend_is_touched,
+	.pf_read_aux	= xpt2046_backend_xpt2046_read_aux,
+	.pressure		= true,
+};
+
+// TSC2046
+const xpt2046_backend_t g_xpt2046_backend_tsc2046 =
+{
+	.pf_init		= xpt2046_backend_init,
+	.pf_acquire		= xpt2046_backend_xpt2046_acquire,
+	.pf_set_power	= xpt2046_backend_set_power,
+	.pf_is_touched	= xpt2046_backend_is_touched,
+	.pf_read_aux	= xpt2046_backend_xpt2046_read_aux,
+	.pressure		= true,
+};
+
+// ADS7843
+const xpt2046_backend_t g_xpt2046_backend_ads7843 =
+{
+	.pf_init		= xpt2046_backend_init,
+	.pf_acquire		= xpt2046_backend_ads7843_acquire,
+	.pf_set_power	= xpt2046_backend_ads7843_set_power,
+	.pf_is_touched	= xpt2046_backend_is_touched,
+	.pf_read_aux	= xpt2046_backend_ads7843_read_aux,
+	.pressure		= false,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize controller
+*
+* @return 		status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_init(void)
+{
+	return xpt2046_if_init();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get PENIRQ state
+*
+* @return 		touched - True if touch is detected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool xpt2046_backend_is_touched(void)
+{
+	return ( eXPT2046_INT_ON == xpt2046_low_if_get_int());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set power mode between conversions
+*
+* @note		Power down bits take effect with conversion, thus single
+* 			dummy Y conversion is made.
+*
+* @param[in]	mode	- Power mode
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_set_power(const xpt2046_power_t mode)
+{
+	static const xpt2046_pd_t pd[] =
+	{
+		[ eXPT2046_POWER_DOWN ]		= eXPT2046_PD_POWER_DOWN,
+		[ eXPT2046_POWER_REF_ON ]	= eXPT2046_PD_VREF_ON,
+		[ eXPT2046_POWER_FULLY_ON ]	= eXPT2046_PD_DEVICE_FULLY_ON,
+	};
+	xpt2046_status_t status = eXPT2046_ERROR;
+	uint16_t dummy;
+
+	if ( mode <= eXPT2046_POWER_FULLY_ON )
+	{
+		status = xpt2046_low_if_exchange( eXPT2046_ADDR_Y_POS, pd[ mode ], eXPT2046_START_ON, &dummy );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read auxiliary channel
+*
+* @note		Auxiliary channels are converted in single ended mode. PENIRQ
+* 			is enabled afterwards.
+*
+* @param[in]	addr	- Channel address
+* @param[in]	pd_mode	- Power down mode after conversion
+* @param[out]	p_val	- Pointer to conversion result
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_read_aux(const xpt2046_addr_t addr, const xpt2046_pd_t pd_mode, uint16_t * const p_val)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+	xpt2046_low_if_cmd_t cmd;
+
+	if 	(	( addr < eXPT2046_ADDR_NUM_OF )
+		&&	( NULL != p_val ))
+	{
+		cmd.addr 			= addr;
+		cmd.pd_mode 		= pd_mode;
+		cmd.single_ended 	= true;
+
+		status = xpt2046_low_if_exchange_burst( &cmd, 1U, p_val );
+	}
+
+	return status;
+}
+
+#if ( 1 == XPT2046_SYM_BURST_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Merge symmetric burst to common timestamp
+	*
+	* @note		X and Y are converted in order X, Y, ..., Y, X with equal
+	* 			frame spacing, thus mean of each pair is linear interpolation
+	* 			of that axis to burst centre. Motion within burst is sum of
+	* 			absolute pair differences.
+	*
+	* @param[in]	x1		- First X conversion
+	* @param[in]	y1		- First Y conversion
+	* @param[in]	y2		- Second Y conversion
+	* @param[in]	x2		- Second X conversion
+	* @param[out]	p_raw	- Pointer to raw sample
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void xpt2046_backend_sym_merge(const uint16_t x1, const uint16_t y1, const uint16_t y2, const uint16_t x2, xpt2046_raw_t * const p_raw)
+	{
+		const uint16_t dx = ( x2 > x1 ) ? ( x2 - x1 ) : ( x1 - x2 );
+		const uint16_t dy = ( y2 > y1 ) ? ( y2 - y1 ) : ( y1 - y2 );
+
+		p_raw->x 		= (uint16_t)(( (uint32_t) x1 + x2 + 1U ) / 2U );
+		p_raw->y 		= (uint16_t)(( (uint32_t) y1 + y2 + 1U ) / 2U );
+		p_raw->motion 	= dx + dy;
+	}
+
+#endif // 1 == XPT2046_SYM_BURST_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		XPT2046/TSC2046 touch acquisition
+*
+* @note		X, Y, Z1 and Z2 are converted in single SPI burst. With
+* 			symmetric burst Y and X are converted once more at the end.
+*
+* @param[out]	p_raw	- Pointer to raw sample
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_xpt2046_acquire(xpt2046_raw_t * const p_raw)
+{
+	xpt2046_status_t status;
+	uint16_t adc[ XPT2046_ACQ_BURST_NUM ];
+
+	status = xpt2046_low_if_exchange_burst( g_acq_burst_xpt2046, XPT2046_ACQ_BURST_NUM, adc );
+
+	if ( eXPT2046_OK == status )
+	{
+		#if ( 1 == XPT2046_SYM_BURST_EN )
+			xpt2046_backend_sym_merge( adc[ eXPT2046_ACQ_X ], adc[ eXPT2046_ACQ_Y ], adc[ eXPT2046_ACQ_Y2 ], adc[ eXPT2046_ACQ_X2 ], p_raw );
+		#else
+			p_raw->x 		= adc[ eXPT2046_ACQ_X ];
+			p_raw->y 		= adc[ eXPT2046_ACQ_Y ];
+			p_raw->motion 	= 0U;
+		#endif
+
+		p_raw->z1 	= adc[ eXPT2046_ACQ_Z1 ];
+		p_raw->z2 	= adc[ eXPT2046_ACQ_Z2 ];
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		XPT2046/TSC2046 auxiliary channel readout
+*
+* @param[in]	ch		- Auxiliary channel
+* @param[out]	p_val	- Pointer to conversion result
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_xpt2046_read_aux(const xpt2046_aux_t ch, uint16_t * const p_val)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+
+	if ( ch < eXPT2046_AUX_NUM_OF )
+	{
+		// NOTE: Internal reference is kept on for next reading
+		status = xpt2046_backend_read_aux( g_aux_addr_xpt2046[ ch ], eXPT2046_PD_VREF_ON, p_val );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		ADS7843 touch acquisition
+*
+* @note		ADS7843 can not measure pressure, Z1 and Z2 are reported
+* 			as zero and backend has no pressure capability.
+*
+* @param[out]	p_raw	- Pointer to raw sample
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_ads7843_acquire(xpt2046_raw_t * const p_raw)
+{
+	xpt2046_status_t status;
+	uint16_t adc[ XPT2046_ACQ_BURST_NUM_ADS7843 ];
+
+	status = xpt2046_low_if_exchange_burst( g_acq_burst_ads7843, XPT2046_ACQ_BURST_NUM_ADS7843, adc );
+
+	if ( eXPT2046_OK == status )
+	{
+		#if ( 1 == XPT2046_SYM_BURST_EN )
+			xpt2046_backend_sym_merge( adc[ eXPT2046_ACQ_ADS7843_X ], adc[ eXPT2046_ACQ_ADS7843_Y ], adc[ eXPT2046_ACQ_ADS7843_Y2 ], adc[ eXPT2046_ACQ_ADS7843_X2 ], p_raw );
+		#else
+			p_raw->x 		= adc[ eXPT2046_ACQ_ADS7843_X ];
+			p_raw->y 		= adc[ eXPT2046_ACQ_ADS7843_Y ];
+			p_raw->motion 	= 0U;
+		#endif
+
+		p_raw->z1 	= 0U;
+		p_raw->z2 	= 0U;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		ADS7843 power mode
+*
+* @note		ADS7843 has no separate reference control, reference on mode
+* 			falls back to power down.
+*
+* @param[in]	mode	- Power mode
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_ads7843_set_power(const xpt2046_power_t mode)
+{
+	xpt2046_status_t status;
+
+	if ( eXPT2046_POWER_REF_ON == mode )
+	{
+		status = xpt2046_backend_set_power( eXPT2046_POWER_DOWN );
+	}
+	else
+	{
+		status = xpt2046_backend_set_power( mode );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		ADS7843 auxiliary channel readout
+*
+* @param[in]	ch		- Auxiliary channel
+* @param[out]	p_val	- Pointer to conversion result
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_ads7843_read_aux(const xpt2046_aux_t ch, uint16_t * const p_val)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+
+	if ( ch < eXPT2046_AUX_NUM_OF )
+	{
+		status = xpt2046_backend_read_aux( g_aux_addr_ads7843[ ch ], eXPT2046_PD_POWER_DOWN, p_val );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
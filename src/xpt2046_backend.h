@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_backend.h
+*@brief     Resistive touch controller backends
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BACKEND
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Resistive touch controller backends.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_BACKEND_H_
+#define _XPT2046_BACKEND_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Raw touch sample
+typedef struct
+{
+	uint16_t	x;		// X plate position [ADC]
+	uint16_t	y;		// Y plate position [ADC]
+	uint16_t	z1;		// Pressure Z1 [ADC], 0 when not supported
+	uint16_t	z2;		// Pressure Z2 [ADC], 0 when not supported
+	uint16_t	motion;	// Position change within burst [ADC], 0 when not measured
+} xpt2046_raw_t;
+
+// Power mode between conversions
+typedef enum
+{
+	eXPT2046_POWER_DOWN = 0,	// Everything off, PENIRQ enabled
+	eXPT2046_POWER_REF_ON,		// Reference kept on, PENIRQ enabled
+	eXPT2046_POWER_FULLY_ON,	// Always on, PENIRQ disabled
+} xpt2046_power_t;
+
+// Auxiliary channels
+typedef enum
+{
+	eXPT2046_AUX_TEMP_0 = 0,	// Temperature diode, single reading
+	eXPT2046_AUX_TEMP_1,		// Temperature diode, second reading
+	eXPT2046_AUX_VBAT,			// Battery monitor (ADS7843: IN3)
+	eXPT2046_AUX_IN,			// Auxiliary input (ADS7843: IN4)
+
+	eXPT2046_AUX_NUM_OF,
+} xpt2046_aux_t;
+
+/**
+ * 	Controller backend
+ *
+ * 	All functions are called from touch handler context.
+ */
+typedef struct
+{
+	xpt2046_status_t	(*pf_init)		(void);
+	xpt2046_status_t	(*pf_acquire)	(xpt2046_raw_t * const p_raw);
+	xpt2046_status_t	(*pf_set_power)	(const xpt2046_power_t mode);
+	bool				(*pf_is_touched)(void);
+	xpt2046_status_t	(*pf_read_aux)	(const xpt2046_aux_t ch, uint16_t * const p_val);
+	bool				pressure;		// Pressure (Z1/Z2) is measured
+} xpt2046_backend_t;
+
+/**
+ * 	Built-in backends
+ *
+ * 	TI TSC2046 is pin and command compatible with XPT2046. TI ADS7843
+ * 	has no pressure (Z1/Z2) and temperature channels.
+ */
+extern const xpt2046_backend_t g_xpt2046_backend_xpt2046;
+extern const xpt2046_backend_t g_xpt2046_backend_tsc2046;
+extern const xpt2046_backend_t g_xpt2046_backend_ads7843;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_read_aux	(const xpt2046_aux_t ch, uint16_t * const p_val);
+
+#endif // _XPT2046_BACKEND_H_
@@ -0,0 +1,328 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_backend_adc.c
+*@brief     Controller-less backend using MCU ADC and GPIO plate drive
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BACKEND_ADC
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Controller-less backend using MCU ADC and GPIO plate drive.
+*
+* 	Four panel terminals are driven directly from MCU pins and touch
+* 	point voltage is sampled by internal ADC. Each measurement is burst
+* 	of XPT2046_ADC_SETTLE_SAMP + XPT2046_ADC_OVERSAMP samples (e.g. via
+* 	DMA), first samples are discarded while panel capacitance settles
+* 	and the rest are averaged. Results are scaled to 12-bit, same as
+* 	XPT2046 conversion results, thus filter, calibration and pressure
+* 	work unchanged.
+*
+* 	Plate drive per measurement:
+*
+* 		X:		X+ high, X- low, sample Y+
+* 		Y:		Y+ high, Y- low, sample X+
+* 		Z1/Z2:	Y+ high, X- low, sample X+ (Z1) and Y- (Z2)
+* 		Pen:	X- low, Y+ pull-up, touched when Y+ reads low
+*
+* 	Platform provides plate drive and ADC sampling in xpt2046_if (see
+* 	template/xpt2046_if_adc.htmp).
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_backend_adc.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_ADC_EN )
+
+#include "../../xpt2046_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Samples per measurement
+#define XPT2046_ADC_BURST_SAMP			( XPT2046_ADC_SETTLE_SAMP + XPT2046_ADC_OVERSAMP )
+
+// Measurement plate drive
+typedef struct
+{
+	xpt2046_plate_mode_t	mode[ eXPT2046_PLATE_NUM_OF ];
+} xpt2046_drive_t;
+
+// Measurements
+typedef enum
+{
+	eXPT2046_DRIVE_X = 0,
+	eXPT2046_DRIVE_Y,
+	eXPT2046_DRIVE_Z,
+	eXPT2046_DRIVE_PEN,
+
+	eXPT2046_DRIVE_NUM_OF,
+} xpt2046_drive_id_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Plate drive configurations (XP, XN, YP, YN)
+static const xpt2046_drive_t g_drive[ eXPT2046_DRIVE_NUM_OF ] =
+{
+	[ eXPT2046_DRIVE_X ]	= {{ eXPT2046_PLATE_HIGH, eXPT2046_PLATE_LOW, eXPT2046_PLATE_HIZ, eXPT2046_PLATE_HIZ }},
+	[ eXPT2046_DRIVE_Y ]	= {{ eXPT2046_PLATE_HIZ, eXPT2046_PLATE_HIZ, eXPT2046_PLATE_HIGH, eXPT2046_PLATE_LOW }},
+	[ eXPT2046_DRIVE_Z ]	= {{ eXPT2046_PLATE_HIZ, eXPT2046_PLATE_LOW, eXPT2046_PLATE_HIGH, eXPT2046_PLATE_HIZ }},
+	[ eXPT2046_DRIVE_PEN ]	= {{ eXPT2046_PLATE_HIZ, eXPT2046_PLATE_LOW, eXPT2046_PLATE_PULLUP, eXPT2046_PLATE_HIZ }},
+};
+
+// Sample buffer
+static uint16_t g_adc_buf[ XPT2046_ADC_BURST_SAMP ];
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t	xpt2046_backend_adc_init		(void);
+static xpt2046_status_t	xpt2046_backend_adc_acquire		(xpt2046_raw_t * const p_raw);
+static xpt2046_status_t	xpt2046_backend_adc_set_power	(const xpt2046_power_t mode);
+static bool				xpt2046_backend_adc_is_touched	(void);
+static xpt2046_status_t	xpt2046_backend_adc_read_aux	(const xpt2046_aux_t ch, uint16_t * const p_val);
+
+static void				xpt2046_backend_adc_drive		(const xpt2046_drive_id_t drive);
+static xpt2046_status_t	xpt2046_backend_adc_measure		(const xpt2046_plate_t plate, uint16_t * const p_val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Backend
+////////////////////////////////////////////////////////////////////////////////
+
+// MCU ADC
+const xpt2046_backend_t g_xpt2046_backend_adc =
+{
+	.pf_init		= xpt2046_backend_adc_init,
+	.pf_acquire		= xpt2046_backend_adc_acquire,
+	.pf_set_power	= xpt2046_backend_adc_set_power,
+	.pf_is_touched	= xpt2046_backend_adc_is_touched,
+	.pf_read_aux	= xpt2046_backend_adc_read_aux,
+	.pressure		= true,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize plate drive and ADC
+*
+* @note		Plates are left in pen detection mode.
+*
+* @return 		status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_adc_init(void)
+{
+	xpt2046_status_t status;
+
+	status = xpt2046_if_init();
+
+	xpt2046_backend_adc_drive( eXPT2046_DRIVE_PEN );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Touch acquisition
+*
+* @note		With symmetric burst Y and X are measured once more after
+* 			pressure and each axis is averaged to common instant.
+*
+* @param[out]	p_raw	- Pointer to raw sample
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_adc_acquire(xpt2046_raw_t * const p_raw)
+{
+	xpt2046_status_t status;
+
+	#if ( 1 == XPT2046_SYM_BURST_EN )
+		uint16_t x2;
+		uint16_t y2;
+	#endif
+
+	// X position
+	xpt2046_backend_adc_drive( eXPT2046_DRIVE_X );
+	status = xpt2046_backend_adc_measure( eXPT2046_PLATE_YP, &p_raw->x );
+
+	// Y position
+	xpt2046_backend_adc_drive( eXPT2046_DRIVE_Y );
+	status |= xpt2046_backend_adc_measure( eXPT2046_PLATE_XP, &p_raw->y );
+
+	// Pressure
+	xpt2046_backend_adc_drive( eXPT2046_DRIVE_Z );
+	status |= xpt2046_backend_adc_measure( eXPT2046_PLATE_XP, &p_raw->z1 );
+	status |= xpt2046_backend_adc_measure( eXPT2046_PLATE_YN, &p_raw->z2 );
+
+	// Repeat Y and X in reverse order and interpolate to centre
+	#if ( 1 == XPT2046_SYM_BURST_EN )
+		xpt2046_backend_adc_drive( eXPT2046_DRIVE_Y );
+		status |= xpt2046_backend_adc_measure( eXPT2046_PLATE_XP, &y2 );
+
+		xpt2046_backend_adc_drive( eXPT2046_DRIVE_X );
+		status |= xpt2046_backend_adc_measure( eXPT2046_PLATE_YP, &x2 );
+
+		p_raw->motion 	= (uint16_t)((( x2 > p_raw->x ) ? ( x2 - p_raw->x ) : ( p_raw->x - x2 )) + (( y2 > p_raw->y ) ? ( y2 - p_raw->y ) : ( p_raw->y - y2 )));
+		p_raw->x 		= (uint16_t)(( (uint32_t) p_raw->x + x2 + 1U ) / 2U );
+		p_raw->y 		= (uint16_t)(( (uint32_t) p_raw->y + y2 + 1U ) / 2U );
+	#else
+		p_raw->motion 	= 0U;
+	#endif
+
+	// Back to pen detection
+	xpt2046_backend_adc_drive( eXPT2046_DRIVE_PEN );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set power mode
+*
+* @note		Plates draw no current in pen detection mode, thus all modes
+* 			except fully on leave plates in pen detection.
+*
+* @param[in]	mode	- Power mode
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_adc_set_power(const xpt2046_power_t mode)
+{
+	if ( eXPT2046_POWER_FULLY_ON != mode )
+	{
+		xpt2046_backend_adc_drive( eXPT2046_DRIVE_PEN );
+	}
+
+	return eXPT2046_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get pen detection state
+*
+* @return 		touched - True if touch is detected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool xpt2046_backend_adc_is_touched(void)
+{
+	// Touch pulls Y+ low through X plate
+	return ( false == xpt2046_if_plate_read( eXPT2046_PLATE_YP ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read auxiliary channel
+*
+* @note		Not available, MCU ADC channels shall be read directly.
+*
+* @param[in]	ch		- Auxiliary channel
+* @param[out]	p_val	- Pointer to conversion result
+* @return 		status	- Always eXPT2046_ERROR
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_adc_read_aux(const xpt2046_aux_t ch, uint16_t * const p_val)
+{
+	(void) ch;
+	(void) p_val;
+
+	return eXPT2046_ERROR;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Apply plate drive configuration
+*
+* @note		Driven terminals are released first so that plates are never
+* 			shorted during transition.
+*
+* @param[in]	drive	- Drive configuration
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_backend_adc_drive(const xpt2046_drive_id_t drive)
+{
+	uint32_t plate;
+
+	for ( plate = 0; plate < eXPT2046_PLATE_NUM_OF; plate++ )
+	{
+		if ( eXPT2046_PLATE_HIZ == g_drive[ drive ].mode[ plate ] )
+		{
+			xpt2046_if_plate_drive((xpt2046_plate_t) plate, eXPT2046_PLATE_HIZ );
+		}
+	}
+
+	for ( plate = 0; plate < eXPT2046_PLATE_NUM_OF; plate++ )
+	{
+		if ( eXPT2046_PLATE_HIZ != g_drive[ drive ].mode[ plate ] )
+		{
+			xpt2046_if_plate_drive((xpt2046_plate_t) plate, g_drive[ drive ].mode[ plate ] );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Measure plate terminal voltage
+*
+* @param[in]	plate	- Plate terminal
+* @param[out]	p_val	- Pointer to 12-bit result
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_backend_adc_measure(const xpt2046_plate_t plate, uint16_t * const p_val)
+{
+	xpt2046_status_t status;
+	uint32_t sum = 0;
+	uint32_t i;
+
+	status = xpt2046_if_adc_sample( plate, g_adc_buf, XPT2046_ADC_BURST_SAMP );
+
+	if ( eXPT2046_OK == status )
+	{
+		// Skip settling samples
+		for ( i = XPT2046_ADC_SETTLE_SAMP; i < XPT2046_ADC_BURST_SAMP; i++ )
+		{
+			sum += g_adc_buf[i];
+		}
+
+		sum /= XPT2046_ADC_OVERSAMP;
+
+		// Scale to 12-bit
+		#if ( XPT2046_ADC_BITS > 12 )
+			sum >>= ( XPT2046_ADC_BITS - 12 );
+		#elif ( XPT2046_ADC_BITS < 12 )
+			sum <<= ( 12 - XPT2046_ADC_BITS );
+		#endif
+
+		*p_val = (uint16_t) sum;
+	}
+
+	return status;
+}
+
+#endif // 1 == XPT2046_ADC_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
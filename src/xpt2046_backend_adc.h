@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_backend_adc.h
+*@brief     Controller-less backend using MCU ADC and GPIO plate drive
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BACKEND_ADC
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Controller-less backend using MCU ADC and GPIO plate drive.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_BACKEND_ADC_H_
+#define _XPT2046_BACKEND_ADC_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "xpt2046_backend.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Panel plate terminals
+typedef enum
+{
+	eXPT2046_PLATE_XP = 0,		// X+ (needs ADC channel)
+	eXPT2046_PLATE_XN,			// X-
+	eXPT2046_PLATE_YP,			// Y+ (needs ADC channel)
+	eXPT2046_PLATE_YN,			// Y- (needs ADC channel)
+
+	eXPT2046_PLATE_NUM_OF,
+} xpt2046_plate_t;
+
+// Plate terminal pin mode
+typedef enum
+{
+	eXPT2046_PLATE_HIZ = 0,		// Analog input, high impedance
+	eXPT2046_PLATE_LOW,			// Push-pull output low
+	eXPT2046_PLATE_HIGH,		// Push-pull output high
+	eXPT2046_PLATE_PULLUP,		// Digital input with pull-up
+} xpt2046_plate_mode_t;
+
+/**
+ * 	MCU ADC backend
+ */
+extern const xpt2046_backend_t g_xpt2046_backend_adc;
+
+#endif // _XPT2046_BACKEND_ADC_H_
@@ -0,0 +1,222 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_class.c
+*@brief     Contact classification (stylus/finger) for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_CLASS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Contact classification and per-class processing profiles.
+*
+* 	First few raw samples of each touch are collected and contact is
+* 	classified based on mean touch resistance and sample to sample
+* 	jitter. Stylus has small contact area, thus high touch resistance
+* 	and low jitter. Finger has large contact area, thus low touch
+* 	resistance and more jitter.
+*
+* 	Once classified, pre-tuned processing profile is used for the rest
+* 	of the contact.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "xpt2046_class.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_CLASS_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of samples used for classification
+#define XPT2046_CLASS_SAMP_NUM					( 4U )
+
+// Stylus thresholds
+#define XPT2046_CLASS_STYLUS_RES_MIN			( 2000U )	// Min. mean touch resistance
+#define XPT2046_CLASS_STYLUS_JITTER_MAX			( 24U )		// Max. mean sample to sample jitter [raw ADC]
+
+// Limit filter window to filter buffer size
+#define XPT2046_CLASS_WIN(win)					(( (win) > XPT2046_FILTER_WIN_SAMP ) ? ( XPT2046_FILTER_WIN_SAMP ) : ( win ))
+
+// Classification data
+typedef struct
+{
+	uint32_t			res_sum;	// Touch resistance sum
+	uint32_t			jitter_sum;	// Jitter sum
+	uint16_t			X_prev;
+	uint16_t			Y_prev;
+	uint8_t				samp_cnt;
+	xpt2046_contact_t	contact;
+} xpt2046_class_t;
+
+XPT2046_MEM_CHECK( class, XPT2046_MEM_SIZE( sizeof( xpt2046_class_t )), XPT2046_MEM_CLASS );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Pre-tuned profiles
+static const xpt2046_profile_t g_profiles[ eXPT2046_CONTACT_NUM_OF ] =
+{
+	// Unknown - moderate smoothing until classified
+	[ eXPT2046_CONTACT_UNKNOWN ] = { .filt_win = XPT2046_CLASS_WIN( 4U ), .outlier_lim = UINT16_MAX,	.release_deb = 1U },
+
+	// Stylus - low lag, tight outlier rejection, tolerate short lift-offs while writing
+	[ eXPT2046_CONTACT_STYLUS ] = { .filt_win = XPT2046_CLASS_WIN( 2U ), .outlier_lim = 64U, 		.release_deb = 2U },
+
+	// Finger - heavy smoothing
+	[ eXPT2046_CONTACT_FINGER ] = { .filt_win = XPT2046_CLASS_WIN( 8U ), .outlier_lim = 128U, 		.release_deb = 3U },
+};
+
+// Classification data
+static xpt2046_class_t * gp_class = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize contact classification
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_class_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_class = xpt2046_mem_alloc( sizeof( xpt2046_class_t ));
+
+	if ( NULL == gp_class )
+	{
+		status = eXPT2046_ERROR;
+	}
+	else
+	{
+		xpt2046_class_reset();
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset classification
+*
+* @note		Shall be called on each new touch.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_class_reset(void)
+{
+	gp_class->res_sum = 0;
+	gp_class->jitter_sum = 0;
+	gp_class->samp_cnt = 0;
+	gp_class->contact = eXPT2046_CONTACT_UNKNOWN;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add raw sample to classification
+*
+* @note		Samples after contact is classified are ignored.
+*
+* @param[in]	X			- Raw X position
+* @param[in]	Y			- Raw Y position
+* @param[in]	resistance	- Raw touch resistance
+* @return 		contact		- Current contact class
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_contact_t xpt2046_class_add_sample(const uint16_t X, const uint16_t Y, const uint16_t resistance)
+{
+	if ( eXPT2046_CONTACT_UNKNOWN == gp_class->contact )
+	{
+		gp_class->res_sum += resistance;
+
+		if ( gp_class->samp_cnt > 0 )
+		{
+			gp_class->jitter_sum += (uint32_t)( abs((int32_t) X - (int32_t) gp_class->X_prev ) + abs((int32_t) Y - (int32_t) gp_class->Y_prev ));
+		}
+
+		gp_class->X_prev = X;
+		gp_class->Y_prev = Y;
+		gp_class->samp_cnt++;
+
+		// Enough samples -> classify
+		if ( gp_class->samp_cnt >= XPT2046_CLASS_SAMP_NUM )
+		{
+			if 	(	(( gp_class->res_sum / XPT2046_CLASS_SAMP_NUM ) >= XPT2046_CLASS_STYLUS_RES_MIN )
+				&&	(( gp_class->jitter_sum / ( XPT2046_CLASS_SAMP_NUM - 1U )) <= XPT2046_CLASS_STYLUS_JITTER_MAX ))
+			{
+				gp_class->contact = eXPT2046_CONTACT_STYLUS;
+			}
+			else
+			{
+				gp_class->contact = eXPT2046_CONTACT_FINGER;
+			}
+		}
+	}
+
+	return gp_class->contact;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get processing profile of current contact
+*
+* @return 		p_profile - Pointer to profile
+*/
+////////////////////////////////////////////////////////////////////////////////
+const xpt2046_profile_t * xpt2046_class_get_profile(void)
+{
+	return &g_profiles[ gp_class->contact ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get current contact class
+*
+* @return 		contact - Contact class
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_contact_t xpt2046_class_get_contact(void)
+{
+	xpt2046_contact_t contact = eXPT2046_CONTACT_UNKNOWN;
+
+	if ( NULL != gp_class )
+	{
+		contact = gp_class->contact;
+	}
+
+	return contact;
+}
+
+#endif // 1 == XPT2046_CLASS_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
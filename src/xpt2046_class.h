@@ -0,0 +1,61 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_class.h
+*@brief     Contact classification (stylus/finger) for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_CLASS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Contact classification and per-class processing profiles.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_CLASS_H_
+#define _XPT2046_CLASS_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Contact class
+typedef enum
+{
+	eXPT2046_CONTACT_UNKNOWN = 0,	// Not yet classified
+	eXPT2046_CONTACT_STYLUS,
+	eXPT2046_CONTACT_FINGER,
+
+	eXPT2046_CONTACT_NUM_OF,
+} xpt2046_contact_t;
+
+// Processing profile
+typedef struct
+{
+	uint8_t		filt_win;		// Filter window in samples
+	uint16_t	outlier_lim;	// Max. deviation from filter average in raw ADC units
+	uint8_t		release_deb;	// Number of released samples before pen-up is reported
+} xpt2046_profile_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t			xpt2046_class_init			(void);
+void						xpt2046_class_reset			(void);
+xpt2046_contact_t			xpt2046_class_add_sample	(const uint16_t X, const uint16_t Y, const uint16_t resistance);
+const xpt2046_profile_t *	xpt2046_class_get_profile	(void);
+xpt2046_contact_t			xpt2046_class_get_contact	(void);
+
+#endif // _XPT2046_CLASS_H_
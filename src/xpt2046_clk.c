@@ -0,0 +1,358 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_clk.c
+*@brief     SPI clock auto-tuning for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_CLK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	SPI clock auto-tuning.
+*
+* 	XPT2046 samples input during three DCLK cycles after channel address
+* 	is clocked in, thus acquisition time is set by SPI clock. With high
+* 	panel resistance or long wires input does not settle within that
+* 	window at fast clock and conversion is pulled towards previously
+* 	converted channel (bias) and picks up more noise.
+*
+* 	Tuning measures still-hold samples at every clock setting provided
+* 	by interface (xpt2046_if_spi_set_clk()). Settings are interleaved
+* 	burst by burst, so slow drift of held pen affects all of them the
+* 	same. Slowest setting is reference. Fastest setting for which it and
+* 	all slower settings stay within XPT2046_CLK_BIAS_MAX of reference
+* 	position and within XPT2046_CLK_NOISE_MAX of reference noise is
+* 	selected and stored to parameter eXPT2046_PAR_SPI_CLK. Setting is
+* 	part of calibration record (see xpt2046_get_cal_record()), thus it
+* 	is saved and restored together with calibration factors.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_clk.h"
+#include "xpt2046_par.h"
+#include "xpt2046_low_if.h"
+#include "xpt2046_backend.h"
+#include "xpt2046_backend_adc.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_CLK_TUNE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Check settings
+#if (( XPT2046_CLK_NUM < 2 ) || ( XPT2046_CLK_NUM > 8 ))
+	#error "XPT2046_CLK_NUM must be in range 2..8!"
+#endif
+
+#if (( XPT2046_CLK_SAMP_NUM < 2 ) || ( XPT2046_CLK_SAMP_NUM > 256 ))
+	#error "XPT2046_CLK_SAMP_NUM must be in range 2..256!"
+#endif
+
+// Fixed point of reported bias and noise (1/16 LSB)
+#define XPT2046_CLK_Q						( 4U )
+
+// Accumulated samples of single clock setting
+typedef struct
+{
+	uint32_t	sum[2];		// X, Y
+	uint64_t	sum_sq[2];	// X, Y
+} xpt2046_clk_acc_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Controller backend
+static const xpt2046_backend_t * const gp_backend = &XPT2046_BACKEND;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t	xpt2046_clk_capture		(xpt2046_clk_acc_t * const p_acc);
+static int32_t			xpt2046_clk_mean		(const uint32_t sum);
+static uint32_t			xpt2046_clk_rms			(const xpt2046_clk_acc_t * const p_acc);
+static uint32_t			xpt2046_clk_isqrt		(const uint64_t val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize SPI clock tuning
+*
+* @note		Applies default clock setting. Stored setting is applied
+* 			when parameters are loaded (xpt2046_par_deserialize()).
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_clk_init(void)
+{
+	return xpt2046_clk_set( XPT2046_CLK_DEF );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Apply SPI clock setting
+*
+* @note		Called on change of eXPT2046_PAR_SPI_CLK parameter. To
+* 			change setting at run-time use xpt2046_par_set().
+*
+* @param[in]	idx		- Clock setting, 0 is slowest
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_clk_set(const uint8_t idx)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+
+	if ( idx < XPT2046_CLK_NUM )
+	{
+		status = xpt2046_low_if_set_clk( idx );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find fastest SPI clock with settled acquisition
+*
+* @note		Blocking for XPT2046_CLK_SAMP_NUM * XPT2046_CLK_NUM acquisition
+* 			bursts. Panel must be held still (e.g. weighted stylus) at
+* 			any position during tuning. Shall be called from same
+* 			context as touch handler.
+*
+* 			Previous setting is restored on failure. On success selected
+* 			setting is applied and stored to eXPT2046_PAR_SPI_CLK, which
+* 			is taken into calibration record.
+*
+* @param[out]	p_result	- Pointer to tuning result
+* @return 		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_clk_tune(xpt2046_clk_result_t * const p_result)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+	xpt2046_clk_acc_t acc[ XPT2046_CLK_NUM ] = { 0 };
+	int32_t ref_x = 0;
+	int32_t ref_y = 0;
+	int32_t dx;
+	int32_t dy;
+	uint32_t ref_noise = 0U;
+	uint32_t i;
+	bool settled = true;
+
+	if ( NULL != p_result )
+	{
+		status = xpt2046_clk_capture( acc );
+
+		if ( eXPT2046_OK == status )
+		{
+			p_result->idx = 0U;
+
+			for ( i = 0; i < XPT2046_CLK_NUM_MAX; i++ )
+			{
+				p_result->meas[i].bias = 0U;
+				p_result->meas[i].noise = 0U;
+				p_result->meas[i].pass = false;
+
+				if ( i < XPT2046_CLK_NUM )
+				{
+					p_result->meas[i].noise = (uint16_t) xpt2046_clk_rms( &acc[i] );
+
+					if ( 0U == i )
+					{
+						// Slowest setting is reference
+						ref_x = xpt2046_clk_mean( acc[i].sum[0] );
+						ref_y = xpt2046_clk_mean( acc[i].sum[1] );
+						ref_noise = p_result->meas[i].noise;
+						p_result->meas[i].pass = true;
+					}
+					else
+					{
+						dx = xpt2046_clk_mean( acc[i].sum[0] ) - ref_x;
+						dy = xpt2046_clk_mean( acc[i].sum[1] ) - ref_y;
+						dx = ( dx < 0 ) ? -dx : dx;
+						dy = ( dy < 0 ) ? -dy : dy;
+
+						p_result->meas[i].bias = (uint16_t)(( dx > dy ) ? dx : dy );
+						p_result->meas[i].pass =	(	( p_result->meas[i].bias <= ( XPT2046_CLK_BIAS_MAX << XPT2046_CLK_Q ))
+													&&	( p_result->meas[i].noise <= ( ref_noise + ( XPT2046_CLK_NOISE_MAX << XPT2046_CLK_Q ))));
+					}
+
+					// Fastest of consecutive passing settings
+					if (( true == settled ) && ( true == p_result->meas[i].pass ))
+					{
+						p_result->idx = (uint8_t) i;
+					}
+					else
+					{
+						settled = false;
+					}
+				}
+			}
+
+			status = xpt2046_clk_set( p_result->idx );
+
+			if ( eXPT2046_OK == status )
+			{
+				status = xpt2046_par_set( eXPT2046_PAR_SPI_CLK, (int32_t) p_result->idx );
+			}
+		}
+		else
+		{
+			(void) xpt2046_clk_set((uint8_t) xpt2046_par_get_value( eXPT2046_PAR_SPI_CLK ));
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Capture still-hold samples at all clock settings
+*
+* @param[out]	p_acc	- Pointer to accumulators, one per setting
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_clk_capture(xpt2046_clk_acc_t * const p_acc)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	xpt2046_raw_t raw;
+	uint32_t i;
+	uint32_t s;
+
+	if ( true == gp_backend->pf_is_touched())
+	{
+		for ( s = 0; ( s < XPT2046_CLK_SAMP_NUM ) && ( eXPT2046_OK == status ); s++ )
+		{
+			for ( i = 0; ( i < XPT2046_CLK_NUM ) && ( eXPT2046_OK == status ); i++ )
+			{
+				status = xpt2046_clk_set((uint8_t) i );
+
+				if ( eXPT2046_OK == status )
+				{
+					status = gp_backend->pf_acquire( &raw );
+				}
+
+				if ( eXPT2046_OK == status )
+				{
+					p_acc[i].sum[0] += raw.x;
+					p_acc[i].sum[1] += raw.y;
+					p_acc[i].sum_sq[0] += (uint64_t) raw.x * raw.x;
+					p_acc[i].sum_sq[1] += (uint64_t) raw.y * raw.y;
+				}
+			}
+		}
+
+		// Pen must be held during whole capture
+		if ( false == gp_backend->pf_is_touched())
+		{
+			status = eXPT2046_ERROR;
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Mean of accumulated samples
+*
+* @param[in]	sum		- Sum of samples
+* @return 		mean	- Rounded mean [1/16 LSB]
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t xpt2046_clk_mean(const uint32_t sum)
+{
+	return (int32_t)((( sum << XPT2046_CLK_Q ) + ( XPT2046_CLK_SAMP_NUM / 2U )) / XPT2046_CLK_SAMP_NUM );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Noise RMS of accumulated samples
+*
+* @param[in]	p_acc	- Pointer to accumulator
+* @return 		rms		- Root of X and Y variance sum [1/16 LSB]
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_clk_rms(const xpt2046_clk_acc_t * const p_acc)
+{
+	const uint64_t n = XPT2046_CLK_SAMP_NUM;
+	uint64_t var = 0U;
+	uint32_t i;
+
+	for ( i = 0; i < 2U; i++ )
+	{
+		// N^2 * variance, non-negative by Cauchy-Schwarz
+		var += ( n * p_acc->sum_sq[i] ) - ((uint64_t) p_acc->sum[i] * p_acc->sum[i] );
+	}
+
+	return xpt2046_clk_isqrt(( var << ( 2U * XPT2046_CLK_Q )) / ( n * n ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Integer square root
+*
+* @param[in]	val		- Input value
+* @return 		root	- Floor of square root
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_clk_isqrt(const uint64_t val)
+{
+	uint64_t rem = val;
+	uint64_t root = 0;
+	uint64_t bit = ( 1ULL << 62 );
+
+	while ( bit > rem )
+	{
+		bit >>= 2;
+	}
+
+	while ( 0U != bit )
+	{
+		if ( rem >= ( root + bit ))
+		{
+			rem -= ( root + bit );
+			root = ( root >> 1 ) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+
+		bit >>= 2;
+	}
+
+	return (uint32_t) root;
+}
+
+#endif // 1 == XPT2046_CLK_TUNE_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_clk.h
+*@brief     SPI clock auto-tuning for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_CLK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	SPI clock auto-tuning.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_CLK_H_
+#define _XPT2046_CLK_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Max. number of clock settings
+ */
+#define XPT2046_CLK_NUM_MAX					( 8U )
+
+// Measurement of single clock setting
+typedef struct
+{
+	uint16_t	bias;		// Max. X/Y mean offset against slowest setting [1/16 LSB]
+	uint16_t	noise;		// Noise RMS of X and Y [1/16 LSB]
+	bool		pass;		// Within tolerance
+} xpt2046_clk_meas_t;
+
+// Tuning result
+typedef struct
+{
+	xpt2046_clk_meas_t	meas[ XPT2046_CLK_NUM_MAX ];	// Per clock setting, index 0 is slowest (reference)
+	uint8_t				idx;							// Selected clock setting
+} xpt2046_clk_result_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_clk_init		(void);
+xpt2046_status_t	xpt2046_clk_set			(const uint8_t idx);
+xpt2046_status_t	xpt2046_clk_tune		(xpt2046_clk_result_t * const p_result);
+
+#endif // _XPT2046_CLK_H_
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_conf.c
+*@brief     Touch sample confidence score for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_CONF
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch sample confidence score.
+*
+* 	Score is product of four terms, each in range 0-1:
+*
+* 		- settling: grows linearly from pen-down to XPT2046_CONF_SETTLE_MS,
+* 		  covers contact bounce and filter window fill
+* 		- pressure: grows linearly up to XPT2046_CONF_PRESSURE_MIN, light
+* 		  touches have high plate contact resistance and jitter
+* 		- spread: falls linearly to zero at XPT2046_CONF_SPREAD_MAX ADC
+* 		  change within acquisition burst
+* 		- live: zero when sample is held during pen release debounce
+*
+* 	and is reported in range 0-XPT2046_CONF_MAX.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_conf.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_CONF_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Term fraction bits
+#define XPT2046_CONF_FRAC					( 8U )
+#define XPT2046_CONF_ONE					( 1UL << XPT2046_CONF_FRAC )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_conf_ramp(const uint32_t val, const uint32_t full);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate sample confidence
+*
+* @param[in]	p_in	- Pointer to confidence inputs
+* @return 		conf	- Confidence score (0-XPT2046_CONF_MAX)
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint8_t xpt2046_conf_calc(const xpt2046_conf_in_t * const p_in)
+{
+	uint32_t conf = 0;
+
+	if 	(	( NULL != p_in )
+		&&	( true == p_in->live ))
+	{
+		// Settling
+		conf = xpt2046_conf_ramp( p_in->age_ms, XPT2046_CONF_SETTLE_MS );
+
+		// Pressure
+		if ( XPT2046_CONF_PRESSURE_NA != p_in->pressure )
+		{
+			conf = ( conf * xpt2046_conf_ramp( p_in->pressure, XPT2046_CONF_PRESSURE_MIN )) >> XPT2046_CONF_FRAC;
+		}
+
+		// Spread
+		conf = ( conf * ( XPT2046_CONF_ONE - xpt2046_conf_ramp( p_in->spread, XPT2046_CONF_SPREAD_MAX ))) >> XPT2046_CONF_FRAC;
+
+		conf = ( conf * XPT2046_CONF_MAX ) >> XPT2046_CONF_FRAC;
+	}
+
+	return (uint8_t) conf;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Linear ramp from 0 to 1
+*
+* @param[in]	val		- Input value
+* @param[in]	full	- Input value of full scale
+* @return 		term	- Ramp output in Q8 (0-256)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_conf_ramp(const uint32_t val, const uint32_t full)
+{
+	uint32_t term = XPT2046_CONF_ONE;
+
+	if ( val < full )
+	{
+		term = ( val << XPT2046_CONF_FRAC ) / full;
+	}
+
+	return term;
+}
+
+#endif // 1 == XPT2046_CONF_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
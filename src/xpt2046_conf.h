@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_conf.h
+*@brief     Touch sample confidence score for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_CONF
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch sample confidence score.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_CONF_H_
+#define _XPT2046_CONF_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Maximum confidence score
+ */
+#define XPT2046_CONF_MAX					( 100U )
+
+/**
+ * 	Pressure not available
+ */
+#define XPT2046_CONF_PRESSURE_NA			( UINT16_MAX )
+
+// Confidence inputs
+typedef struct
+{
+	uint32_t	age_ms;		// Time since pen-down [ms]
+	uint16_t	spread;		// Position spread within acquisition [ADC]
+	uint16_t	pressure;	// Normalized pressure or XPT2046_CONF_PRESSURE_NA
+	bool		live;		// Sample backed by current reading (not held by release debounce)
+} xpt2046_conf_in_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+uint8_t xpt2046_conf_calc(const xpt2046_conf_in_t * const p_in);
+
+#endif // _XPT2046_CONF_H_
@@ -0,0 +1,264 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_evt.c
+*@brief     Touch event queue for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_EVT
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch event queue.
+*
+* 	Calibrated touch samples are converted into down/move/up events and
+* 	stored into single producer, single consumer ring buffer. Producer is
+* 	touch handler, consumer is application. No locking is needed as each
+* 	index is written only by one side.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_evt.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_EVT_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Queue size must be power of 2
+#if ( 0 != ( XPT2046_EVT_QUEUE_SIZE & ( XPT2046_EVT_QUEUE_SIZE - 1 )))
+	#error "XPT2046_EVT_QUEUE_SIZE must be power of 2!"
+#endif
+
+#define XPT2046_EVT_IDX_MASK				( XPT2046_EVT_QUEUE_SIZE - 1UL )
+
+// Event queue
+typedef struct
+{
+	xpt2046_evt_t		buf[ XPT2046_EVT_QUEUE_SIZE ];
+	volatile uint32_t	head;		// Written by producer only
+	volatile uint32_t	tail;		// Written by consumer only
+	uint32_t			lost;		// Number of dropped events
+} xpt2046_evt_queue_t;
+
+// Event generator
+typedef struct
+{
+	uint16_t	x_prev;
+	uint16_t	y_prev;
+	bool		pressed_prev;
+} xpt2046_evt_gen_t;
+
+XPT2046_MEM_CHECK( evt, XPT2046_MEM_SIZE( sizeof( xpt2046_evt_queue_t )) + XPT2046_MEM_SIZE( sizeof( xpt2046_evt_gen_t )), XPT2046_MEM_EVT );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Event queue
+static xpt2046_evt_queue_t * gp_evt_queue = NULL;
+
+// Event generator
+static xpt2046_evt_gen_t * gp_evt_gen = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize event queue
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_evt_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_evt_queue = xpt2046_mem_alloc( sizeof( xpt2046_evt_queue_t ));
+	gp_evt_gen = xpt2046_mem_alloc( sizeof( xpt2046_evt_gen_t ));
+
+	if 	(	( NULL == gp_evt_queue )
+		||	( NULL == gp_evt_gen ))
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Generate events from calibrated touch sample
+*
+* @note		Move event is generated only when position changes.
+*
+* @param[in]	x			- Display x coordinate
+* @param[in]	y			- Display y coordinate
+* @param[in]	pressure	- Touch pressure
+* @param[in]	pressed		- Pressed state
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_evt_from_touch(const uint16_t x, const uint16_t y, const uint16_t pressure, const bool pressed)
+{
+	xpt2046_evt_t evt;
+	bool gen = true;
+
+	evt.timestamp 	= XPT2046_GET_SYSTICK();
+	evt.x 			= x;
+	evt.y 			= y;
+	evt.pressure 	= pressure;
+
+	if 	(	( true == pressed )
+		&&	( false == gp_evt_gen->pressed_prev ))
+	{
+		evt.type = eXPT2046_EVT_DOWN;
+	}
+	else if (	( true == pressed )
+			&&	(( x != gp_evt_gen->x_prev ) || ( y != gp_evt_gen->y_prev )))
+	{
+		evt.type = eXPT2046_EVT_MOVE;
+	}
+	else if (	( false == pressed )
+			&&	( true == gp_evt_gen->pressed_prev ))
+	{
+		evt.type = eXPT2046_EVT_UP;
+	}
+	else
+	{
+		gen = false;
+	}
+
+	if ( true == gen )
+	{
+		(void) xpt2046_evt_put( &evt );
+	}
+
+	gp_evt_gen->x_prev = x;
+	gp_evt_gen->y_prev = y;
+	gp_evt_gen->pressed_prev = pressed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Put event to queue
+*
+* @note		Shall be called only from touch handler context.
+*
+* @param[in]	p_evt	- Pointer to event
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_evt_put(const xpt2046_evt_t * const p_evt)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	const uint32_t head = gp_evt_queue->head;
+
+	if (( head - gp_evt_queue->tail ) < XPT2046_EVT_QUEUE_SIZE )
+	{
+		gp_evt_queue->buf[ head & XPT2046_EVT_IDX_MASK ] = *p_evt;
+		gp_evt_queue->head = head + 1UL;
+	}
+	else
+	{
+		gp_evt_queue->lost++;
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get event from queue
+*
+* @param[out]	p_evt	- Pointer to event
+* @return 		status	- eXPT2046_OK if event was taken, eXPT2046_ERROR if queue is empty
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_evt_get(xpt2046_evt_t * const p_evt)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	uint32_t tail;
+
+	if 	(	( NULL != p_evt )
+		&&	( NULL != gp_evt_queue )
+		&&	( gp_evt_queue->tail != gp_evt_queue->head ))
+	{
+		tail = gp_evt_queue->tail;
+		*p_evt = gp_evt_queue->buf[ tail & XPT2046_EVT_IDX_MASK ];
+		gp_evt_queue->tail = tail + 1UL;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of events in queue
+*
+* @return 		num - Number of pending events
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_evt_get_num(void)
+{
+	uint32_t num = 0;
+
+	if ( NULL != gp_evt_queue )
+	{
+		num = ( gp_evt_queue->head - gp_evt_queue->tail );
+	}
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of events dropped due to full queue
+*
+* @return 		lost - Number of lost events
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_evt_get_lost(void)
+{
+	uint32_t lost = 0;
+
+	if ( NULL != gp_evt_queue )
+	{
+		lost = gp_evt_queue->lost;
+	}
+
+	return lost;
+}
+
+#endif // 1 == XPT2046_EVT_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
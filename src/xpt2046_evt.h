@@ -0,0 +1,65 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_evt.h
+*@brief     Touch event queue for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_EVT
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch event queue.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_EVT_H_
+#define _XPT2046_EVT_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Event type
+typedef enum
+{
+	eXPT2046_EVT_DOWN = 0,		// Touch pressed
+	eXPT2046_EVT_MOVE,			// Touch moved while pressed
+	eXPT2046_EVT_UP,			// Touch released
+
+	eXPT2046_EVT_NUM_OF,
+} xpt2046_evt_type_t;
+
+// Touch event
+typedef struct
+{
+	uint32_t			timestamp;	// Time of event [ms]
+	uint16_t			x;			// Display x coordinate
+	uint16_t			y;			// Display y coordinate
+	uint16_t			pressure;	// Touch pressure (force)
+	xpt2046_evt_type_t	type;		// Event type
+} xpt2046_evt_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_evt_init			(void);
+void				xpt2046_evt_from_touch		(const uint16_t x, const uint16_t y, const uint16_t pressure, const bool pressed);
+xpt2046_status_t	xpt2046_evt_put				(const xpt2046_evt_t * const p_evt);
+xpt2046_status_t	xpt2046_evt_get				(xpt2046_evt_t * const p_evt);
+uint32_t			xpt2046_evt_get_num			(void);
+uint32_t			xpt2046_evt_get_lost		(void);
+
+#endif // _XPT2046_EVT_H_
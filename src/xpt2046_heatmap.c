@@ -0,0 +1,387 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_heatmap.c
+*@brief     Touch heatmap and panel wear statistics for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_HEATMAP
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch heatmap and panel wear statistics.
+*
+* 	Every calibrated touch-down is binned into coarse grid over display.
+* 	Each cell holds saturating touch-down counter, average pressure of
+* 	touch-downs and average jitter of stationary touches. Averages are
+* 	exponential, thus no division is needed at run-time.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "xpt2046_heatmap.h"
+#include "xpt2046_mem.h"
+#include "xpt2046_par.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_HEATMAP_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of cells
+#define XPT2046_HEATMAP_CELL_NUM			( XPT2046_HEATMAP_COLS * XPT2046_HEATMAP_ROWS )
+
+// Coordinate to cell scale factors fixed point (Q16)
+#define XPT2046_HEATMAP_SCALE_SHIFT			( 16U )
+
+// Exponential average coefficient (1/8)
+#define XPT2046_HEATMAP_AVG_SHIFT			( 3U )
+
+// Jitter resolution (Q4) and max. sample to sample movement still taken as jitter [pixel]
+#define XPT2046_HEATMAP_JITTER_SHIFT		( 4U )
+#define XPT2046_HEATMAP_JITTER_MAX			( 4U )
+
+// Heatmap cell
+typedef struct
+{
+	uint16_t	cnt;		// Touch-down counter
+	uint16_t	pressure;	// Average pressure
+	uint16_t	jitter;		// Average jitter (Q4)
+} xpt2046_heatmap_cell_t;
+
+// Heatmap
+typedef struct
+{
+	xpt2046_heatmap_cell_t	cell[ XPT2046_HEATMAP_CELL_NUM ];
+	xpt2046_heatmap_cell_t *p_active;	// Cell of current touch-down
+	uint32_t				col_scale;	// Coordinate to column scale (Q16)
+	uint32_t				row_scale;	// Coordinate to row scale (Q16)
+	uint16_t				x_prev;
+	uint16_t				y_prev;
+	bool					pressed_prev;
+} xpt2046_heatmap_t;
+
+XPT2046_MEM_CHECK( heatmap, XPT2046_MEM_SIZE( sizeof( xpt2046_heatmap_t )), XPT2046_MEM_HEATMAP );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Heatmap
+static xpt2046_heatmap_t * gp_heatmap = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_heatmap_avg		(const uint16_t avg, const uint16_t samp);
+static void 	xpt2046_heatmap_put_u16	(uint8_t * const p_buf, const uint16_t val);
+static uint16_t xpt2046_heatmap_get_u16	(const uint8_t * const p_buf);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize heatmap
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_heatmap_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_heatmap = xpt2046_mem_alloc( sizeof( xpt2046_heatmap_t ));
+
+	if ( NULL != gp_heatmap )
+	{
+		xpt2046_heatmap_set_display_max( (uint16_t) xpt2046_par_get_value( eXPT2046_PAR_DISPLAY_MAX_X ), (uint16_t) xpt2046_par_get_value( eXPT2046_PAR_DISPLAY_MAX_Y ));
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set display limits of heatmap grid
+*
+* @note		Called on change of eXPT2046_PAR_DISPLAY_MAX_X/Y parameters.
+*
+* @param[in]	max_x	- Max. display x coordinate
+* @param[in]	max_y	- Max. display y coordinate
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_heatmap_set_display_max(const uint16_t max_x, const uint16_t max_y)
+{
+	if ( NULL != gp_heatmap )
+	{
+		gp_heatmap->col_scale = (uint32_t)(( XPT2046_HEATMAP_COLS << XPT2046_HEATMAP_SCALE_SHIFT ) / ( max_x + 1UL ));
+		gp_heatmap->row_scale = (uint32_t)(( XPT2046_HEATMAP_ROWS << XPT2046_HEATMAP_SCALE_SHIFT ) / ( max_y + 1UL ));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add calibrated sample to heatmap
+*
+* @note		Shall be called on each calibrated sample. Touch-down is
+* 			detected internally.
+*
+* @param[in]	x			- Calibrated x coordinate
+* @param[in]	y			- Calibrated y coordinate
+* @param[in]	pressure	- Touch pressure
+* @param[in]	pressed		- Pressed state
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_heatmap_add(const uint16_t x, const uint16_t y, const uint16_t pressure, const bool pressed)
+{
+	xpt2046_heatmap_cell_t * p_cell;
+	uint32_t col;
+	uint32_t row;
+	uint32_t move;
+
+	if ( true == pressed )
+	{
+		// Touch-down
+		if ( false == gp_heatmap->pressed_prev )
+		{
+			col = ((uint32_t) x * gp_heatmap->col_scale ) >> XPT2046_HEATMAP_SCALE_SHIFT;
+			row = ((uint32_t) y * gp_heatmap->row_scale ) >> XPT2046_HEATMAP_SCALE_SHIFT;
+
+			if ( col >= XPT2046_HEATMAP_COLS )
+			{
+				col = XPT2046_HEATMAP_COLS - 1U;
+			}
+
+			if ( row >= XPT2046_HEATMAP_ROWS )
+			{
+				row = XPT2046_HEATMAP_ROWS - 1U;
+			}
+
+			p_cell = &gp_heatmap->cell[ ( row * XPT2046_HEATMAP_COLS ) + col ];
+
+			if ( 0U == p_cell->cnt )
+			{
+				p_cell->pressure = pressure;
+			}
+			else
+			{
+				p_cell->pressure = xpt2046_heatmap_avg( p_cell->pressure, pressure );
+			}
+
+			if ( p_cell->cnt < UINT16_MAX )
+			{
+				p_cell->cnt++;
+			}
+
+			gp_heatmap->p_active = p_cell;
+		}
+
+		// Stationary touch -> jitter
+		else if ( NULL != gp_heatmap->p_active )
+		{
+			move = (uint32_t)( abs((int32_t) x - (int32_t) gp_heatmap->x_prev ) + abs((int32_t) y - (int32_t) gp_heatmap->y_prev ));
+
+			if ( move <= XPT2046_HEATMAP_JITTER_MAX )
+			{
+				gp_heatmap->p_active->jitter = xpt2046_heatmap_avg( gp_heatmap->p_active->jitter, (uint16_t)( move << XPT2046_HEATMAP_JITTER_SHIFT ));
+			}
+		}
+		else
+		{
+			// No actions...
+		}
+
+		gp_heatmap->x_prev = x;
+		gp_heatmap->y_prev = y;
+	}
+	else
+	{
+		gp_heatmap->p_active = NULL;
+	}
+
+	gp_heatmap->pressed_prev = pressed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clear heatmap statistics
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_heatmap_clear(void)
+{
+	if ( NULL != gp_heatmap )
+	{
+		memset( &gp_heatmap->cell, 0, sizeof( gp_heatmap->cell ));
+		gp_heatmap->p_active = NULL;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Export heatmap as compact blob
+*
+* @note		Size of buffer shall be at least XPT2046_HEATMAP_EXPORT_SIZE.
+*
+* @param[out]	p_buf	- Pointer to output buffer
+* @param[in]	size	- Size of output buffer
+* @param[out]	p_len	- Pointer to length of exported blob
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_heatmap_export(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	uint8_t * p_cell_buf;
+	uint32_t i;
+
+	if 	(	( NULL != p_buf )
+		&&	( NULL != p_len )
+		&&	( NULL != gp_heatmap )
+		&&	( size >= XPT2046_HEATMAP_EXPORT_SIZE ))
+	{
+		p_buf[0] = XPT2046_HEATMAP_MAGIC_0;
+		p_buf[1] = XPT2046_HEATMAP_MAGIC_1;
+		p_buf[2] = XPT2046_HEATMAP_FORMAT_VER;
+		p_buf[3] = XPT2046_HEATMAP_COLS;
+		p_buf[4] = XPT2046_HEATMAP_ROWS;
+		p_buf[5] = 0U;
+
+		p_cell_buf = &p_buf[ XPT2046_HEATMAP_HEADER_SIZE ];
+
+		for ( i = 0; i < XPT2046_HEATMAP_CELL_NUM; i++ )
+		{
+			xpt2046_heatmap_put_u16( &p_cell_buf[0], gp_heatmap->cell[i].cnt );
+			xpt2046_heatmap_put_u16( &p_cell_buf[2], gp_heatmap->cell[i].pressure );
+			xpt2046_heatmap_put_u16( &p_cell_buf[4], gp_heatmap->cell[i].jitter );
+
+			p_cell_buf += XPT2046_HEATMAP_CELL_SIZE;
+		}
+
+		*p_len = XPT2046_HEATMAP_EXPORT_SIZE;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Import heatmap from blob
+*
+* @note		Used to restore statistics after power cycle. Blob must be
+* 			exported with same grid configuration.
+*
+* @param[in]	p_buf	- Pointer to blob
+* @param[in]	len		- Length of blob
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_heatmap_import(const uint8_t * const p_buf, const uint32_t len)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	const uint8_t * p_cell_buf;
+	uint32_t i;
+
+	if 	(	( NULL != p_buf )
+		&&	( NULL != gp_heatmap )
+		&&	( XPT2046_HEATMAP_EXPORT_SIZE == len )
+		&&	( XPT2046_HEATMAP_MAGIC_0 == p_buf[0] )
+		&&	( XPT2046_HEATMAP_MAGIC_1 == p_buf[1] )
+		&&	( XPT2046_HEATMAP_FORMAT_VER == p_buf[2] )
+		&&	( XPT2046_HEATMAP_COLS == p_buf[3] )
+		&&	( XPT2046_HEATMAP_ROWS == p_buf[4] ))
+	{
+		p_cell_buf = &p_buf[ XPT2046_HEATMAP_HEADER_SIZE ];
+
+		for ( i = 0; i < XPT2046_HEATMAP_CELL_NUM; i++ )
+		{
+			gp_heatmap->cell[i].cnt 		= xpt2046_heatmap_get_u16( &p_cell_buf[0] );
+			gp_heatmap->cell[i].pressure 	= xpt2046_heatmap_get_u16( &p_cell_buf[2] );
+			gp_heatmap->cell[i].jitter 	= xpt2046_heatmap_get_u16( &p_cell_buf[4] );
+
+			p_cell_buf += XPT2046_HEATMAP_CELL_SIZE;
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Exponential average
+*
+* @param[in]	avg		- Current average
+* @param[in]	samp	- New sample
+* @return 		avg		- New average
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_heatmap_avg(const uint16_t avg, const uint16_t samp)
+{
+	return (uint16_t)((int32_t) avg + (((int32_t) samp - (int32_t) avg ) >> XPT2046_HEATMAP_AVG_SHIFT ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store 16-bit value as little endian
+*
+* @param[out]	p_buf	- Pointer to buffer
+* @param[in]	val		- Value
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_heatmap_put_u16(uint8_t * const p_buf, const uint16_t val)
+{
+	p_buf[0] = (uint8_t)( val & 0xFFU );
+	p_buf[1] = (uint8_t)( val >> 8U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load 16-bit little endian value
+*
+* @param[in]	p_buf	- Pointer to buffer
+* @return 		val		- Value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_heatmap_get_u16(const uint8_t * const p_buf)
+{
+	return (uint16_t)( (uint16_t) p_buf[0] | ((uint16_t) p_buf[1] << 8U ));
+}
+
+#endif // 1 == XPT2046_HEATMAP_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_heatmap.h
+*@brief     Touch heatmap and panel wear statistics for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_HEATMAP
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch heatmap and panel wear statistics.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_HEATMAP_H_
+#define _XPT2046_HEATMAP_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Export blob layout (little endian)
+ *
+ * 	Header:
+ * 		[0..1] Magic "XH"
+ * 		[2]    Format version
+ * 		[3]    Number of columns
+ * 		[4]    Number of rows
+ * 		[5]    Reserved
+ *
+ * 	Cells (row major), each:
+ * 		[0..1] Touch-down count (saturating)
+ * 		[2..3] Average pressure
+ * 		[4..5] Average jitter [1/16 pixel]
+ */
+#define XPT2046_HEATMAP_MAGIC_0				( 'X' )
+#define XPT2046_HEATMAP_MAGIC_1				( 'H' )
+#define XPT2046_HEATMAP_FORMAT_VER			( 1U )
+#define XPT2046_HEATMAP_HEADER_SIZE			( 6U )
+#define XPT2046_HEATMAP_CELL_SIZE			( 6U )
+
+/**
+ * 	Size of export blob in bytes
+ */
+#define XPT2046_HEATMAP_EXPORT_SIZE			( XPT2046_HEATMAP_HEADER_SIZE + ( XPT2046_HEATMAP_COLS * XPT2046_HEATMAP_ROWS * XPT2046_HEATMAP_CELL_SIZE ))
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_heatmap_init				(void);
+void				xpt2046_heatmap_set_display_max		(const uint16_t max_x, const uint16_t max_y);
+void				xpt2046_heatmap_add					(const uint16_t x, const uint16_t y, const uint16_t pressure, const bool pressed);
+void				xpt2046_heatmap_clear				(void);
+xpt2046_status_t	xpt2046_heatmap_export				(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len);
+xpt2046_status_t	xpt2046_heatmap_import				(const uint8_t * const p_buf, const uint32_t len);
+
+#endif // _XPT2046_HEATMAP_H_
@@ -0,0 +1,379 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_inject.c
+*@brief     Synthetic touch injection for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_INJECT
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Synthetic touch injection and scripted touch player.
+*
+* 	Injected samples are taken by touch handler at selected pipeline
+* 	stage, one sample per handler call, as if they came from the chip.
+* 	While injected samples are pending, they take precedence over
+* 	real data at that stage.
+*
+* 	Script player time advances by XPT2046_HNDL_PERIOD_MS on each handler
+* 	call and not by wall clock, thus tests can call handler in tight loop
+* 	and run at full speed.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_inject.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_INJECT_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Queue size must be power of 2
+#if ( 0 != ( XPT2046_INJECT_QUEUE_SIZE & ( XPT2046_INJECT_QUEUE_SIZE - 1 )))
+	#error "XPT2046_INJECT_QUEUE_SIZE must be power of 2!"
+#endif
+
+#define XPT2046_INJECT_IDX_MASK				( XPT2046_INJECT_QUEUE_SIZE - 1UL )
+
+// Injection queue
+typedef struct
+{
+	xpt2046_inject_samp_t	buf[ XPT2046_INJECT_QUEUE_SIZE ];
+	volatile uint32_t		head;	// Written by injecting side only
+	volatile uint32_t		tail;	// Written by touch handler only
+} xpt2046_inject_queue_t;
+
+// Script player
+typedef struct
+{
+	const xpt2046_script_step_t *	p_script;
+	uint32_t						num_of_steps;
+	uint32_t						step;
+	uint32_t						elapsed;	// Time in current step [ms]
+	uint16_t						x_start;	// Position at start of step
+	uint16_t						y_start;
+	xpt2046_inject_stage_t			stage;
+	xpt2046_inject_samp_t			samp;		// Sample of current handler cycle
+	bool							samp_valid;
+	volatile bool					active;
+} xpt2046_player_t;
+
+XPT2046_MEM_CHECK( inject, XPT2046_MEM_SIZE( eXPT2046_INJECT_NUM_OF * sizeof( xpt2046_inject_queue_t )) + XPT2046_MEM_SIZE( sizeof( xpt2046_player_t )), XPT2046_MEM_INJECT );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Injection queues
+static xpt2046_inject_queue_t * gp_inject_queue = NULL;
+
+// Script player
+static xpt2046_player_t * gp_player = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_inject_interpolate(const uint16_t start, const uint16_t end, const uint32_t elapsed, const uint32_t duration);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize sample injection
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_inject_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_inject_queue = xpt2046_mem_alloc( eXPT2046_INJECT_NUM_OF * sizeof( xpt2046_inject_queue_t ));
+	gp_player = xpt2046_mem_alloc( sizeof( xpt2046_player_t ));
+
+	if 	(	( NULL == gp_inject_queue )
+		||	( NULL == gp_player ))
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Inject single sample to pipeline
+*
+* @note		Sample is consumed by next touch handler call. Injection
+* 			from single context per stage is supported.
+*
+* @param[in]	stage	- Pipeline stage
+* @param[in]	p_samp	- Pointer to sample
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_inject_sample(const xpt2046_inject_stage_t stage, const xpt2046_inject_samp_t * const p_samp)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	xpt2046_inject_queue_t * p_queue;
+	uint32_t head;
+
+	if 	(	( stage < eXPT2046_INJECT_NUM_OF )
+		&&	( NULL != gp_inject_queue )
+		&&	( NULL != p_samp ))
+	{
+		p_queue = &gp_inject_queue[ stage ];
+		head = p_queue->head;
+
+		if (( head - p_queue->tail ) < XPT2046_INJECT_QUEUE_SIZE )
+		{
+			p_queue->buf[ head & XPT2046_INJECT_IDX_MASK ] = *p_samp;
+			p_queue->head = head + 1UL;
+		}
+		else
+		{
+			status = eXPT2046_ERROR;
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Take injected sample for pipeline stage
+*
+* @note		Called by touch handler. Script player has precedence
+* 			over queued samples.
+*
+* @param[in]	stage	- Pipeline stage
+* @param[out]	p_samp	- Pointer to sample
+* @return 		taken	- True if injected sample is available
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool xpt2046_inject_take(const xpt2046_inject_stage_t stage, xpt2046_inject_samp_t * const p_samp)
+{
+	xpt2046_inject_queue_t * p_queue;
+	uint32_t tail;
+	bool taken = false;
+
+	if 	(	( true == gp_player->samp_valid )
+		&&	( stage == gp_player->stage ))
+	{
+		*p_samp = gp_player->samp;
+		taken = true;
+	}
+	else if ( stage < eXPT2046_INJECT_NUM_OF )
+	{
+		p_queue = &gp_inject_queue[ stage ];
+		tail = p_queue->tail;
+
+		if ( tail != p_queue->head )
+		{
+			*p_samp = p_queue->buf[ tail & XPT2046_INJECT_IDX_MASK ];
+			p_queue->tail = tail + 1UL;
+			taken = true;
+		}
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return taken;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start playing touch script
+*
+* @note		Script must stay valid until played. Shall be called from
+* 			same context as touch handler.
+*
+* @param[in]	stage			- Pipeline stage
+* @param[in]	p_script		- Pointer to script
+* @param[in]	num_of_steps	- Number of script steps
+* @return 		status			- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_inject_play(const xpt2046_inject_stage_t stage, const xpt2046_script_step_t * const p_script, const uint32_t num_of_steps)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( stage < eXPT2046_INJECT_NUM_OF )
+		&&	( NULL != gp_player )
+		&&	( NULL != p_script )
+		&&	( num_of_steps > 0 ))
+	{
+		gp_player->active 		= false;
+		gp_player->p_script 		= p_script;
+		gp_player->num_of_steps 	= num_of_steps;
+		gp_player->step 			= 0;
+		gp_player->elapsed 		= 0;
+		gp_player->x_start 		= p_script[0].x;
+		gp_player->y_start 		= p_script[0].y;
+		gp_player->stage 			= stage;
+		gp_player->samp_valid 	= false;
+		gp_player->active 		= true;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stop playing touch script
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_inject_stop(void)
+{
+	if ( NULL != gp_player )
+	{
+		gp_player->active = false;
+		gp_player->samp_valid = false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get script playing status
+*
+* @return 		active - True if script is playing
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool xpt2046_inject_is_playing(void)
+{
+	bool active = false;
+
+	if ( NULL != gp_player )
+	{
+		active = gp_player->active;
+	}
+
+	return active;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Script player handler
+*
+* @note		Called by touch handler at start of each cycle. Prepares
+* 			sample for current cycle and advances script time.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_inject_hndl(void)
+{
+	const xpt2046_script_step_t * p_step;
+
+	gp_player->samp_valid = false;
+
+	if ( true == gp_player->active )
+	{
+		p_step = &gp_player->p_script[ gp_player->step ];
+
+		switch( p_step->cmd )
+		{
+			case eXPT2046_SCRIPT_TOUCH:
+				gp_player->samp.x = p_step->x;
+				gp_player->samp.y = p_step->y;
+				gp_player->samp.force = p_step->force;
+				gp_player->samp.pressed = true;
+				break;
+
+			case eXPT2046_SCRIPT_MOVE:
+				gp_player->samp.x = xpt2046_inject_interpolate( gp_player->x_start, p_step->x, gp_player->elapsed + XPT2046_HNDL_PERIOD_MS, p_step->duration );
+				gp_player->samp.y = xpt2046_inject_interpolate( gp_player->y_start, p_step->y, gp_player->elapsed + XPT2046_HNDL_PERIOD_MS, p_step->duration );
+				gp_player->samp.force = p_step->force;
+				gp_player->samp.pressed = true;
+				break;
+
+			case eXPT2046_SCRIPT_RELEASE:
+			default:
+				gp_player->samp.force = 0;
+				gp_player->samp.pressed = false;
+				break;
+		}
+
+		gp_player->samp_valid = true;
+
+		// Advance script time
+		gp_player->elapsed += XPT2046_HNDL_PERIOD_MS;
+
+		if ( gp_player->elapsed >= p_step->duration )
+		{
+			gp_player->elapsed = 0;
+			gp_player->x_start = gp_player->samp.x;
+			gp_player->y_start = gp_player->samp.y;
+			gp_player->step++;
+
+			if ( gp_player->step >= gp_player->num_of_steps )
+			{
+				gp_player->active = false;
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Linear interpolation between two positions
+*
+* @param[in]	start		- Start position
+* @param[in]	end			- End position
+* @param[in]	elapsed		- Elapsed time
+* @param[in]	duration	- Total time
+* @return 		pos			- Interpolated position
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_inject_interpolate(const uint16_t start, const uint16_t end, const uint32_t elapsed, const uint32_t duration)
+{
+	uint16_t pos;
+
+	if (( 0U == duration ) || ( elapsed >= duration ))
+	{
+		pos = end;
+	}
+	else
+	{
+		pos = (uint16_t)((int32_t) start + ((((int32_t) end - (int32_t) start ) * (int32_t) elapsed ) / (int32_t) duration ));
+	}
+
+	return pos;
+}
+
+#endif // 1 == XPT2046_INJECT_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
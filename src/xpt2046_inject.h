@@ -0,0 +1,90 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_inject.h
+*@brief     Synthetic touch injection for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_INJECT
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Synthetic touch injection and scripted touch player.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_INJECT_H_
+#define _XPT2046_INJECT_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Injection stage
+typedef enum
+{
+	eXPT2046_INJECT_RAW = 0,	// Instead of controller readout (raw ADC, raw touch resistance)
+	eXPT2046_INJECT_CAL,		// After calibration (display coordinates, pressure)
+	eXPT2046_INJECT_EVT,		// Directly to event queue (display coordinates, pressure)
+
+	eXPT2046_INJECT_NUM_OF,
+} xpt2046_inject_stage_t;
+
+// Injected sample
+typedef struct
+{
+	uint16_t	x;
+	uint16_t	y;
+	uint16_t	force;
+	bool		pressed;
+} xpt2046_inject_samp_t;
+
+// Script commands
+typedef enum
+{
+	eXPT2046_SCRIPT_TOUCH = 0,	// Press at position and hold for duration
+	eXPT2046_SCRIPT_MOVE,		// Move linearly to position within duration while pressed
+	eXPT2046_SCRIPT_RELEASE,	// Release and wait for duration
+} xpt2046_script_cmd_t;
+
+// Script step
+typedef struct
+{
+	xpt2046_script_cmd_t	cmd;
+	uint16_t				x;
+	uint16_t				y;
+	uint16_t				force;
+	uint16_t				duration;	// [ms]
+} xpt2046_script_step_t;
+
+/**
+ * 	Script building helpers
+ */
+#define XPT2046_SCRIPT_TAP(x,y,force)				{ eXPT2046_SCRIPT_TOUCH, (x), (y), (force), 80 }, { eXPT2046_SCRIPT_RELEASE, (x), (y), 0, 80 }
+#define XPT2046_SCRIPT_DRAG(x0,y0,x1,y1,force,ms)	{ eXPT2046_SCRIPT_TOUCH, (x0), (y0), (force), 50 }, { eXPT2046_SCRIPT_MOVE, (x1), (y1), (force), (ms) }, { eXPT2046_SCRIPT_RELEASE, (x1), (y1), 0, 80 }
+#define XPT2046_SCRIPT_WAIT(ms)						{ eXPT2046_SCRIPT_RELEASE, 0, 0, 0, (ms) }
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_inject_init			(void);
+xpt2046_status_t	xpt2046_inject_sample		(const xpt2046_inject_stage_t stage, const xpt2046_inject_samp_t * const p_samp);
+bool				xpt2046_inject_take			(const xpt2046_inject_stage_t stage, xpt2046_inject_samp_t * const p_samp);
+xpt2046_status_t	xpt2046_inject_play			(const xpt2046_inject_stage_t stage, const xpt2046_script_step_t * const p_script, const uint32_t num_of_steps);
+void				xpt2046_inject_stop			(void);
+bool				xpt2046_inject_is_playing	(void);
+void				xpt2046_inject_hndl			(void);
+
+#endif // _XPT2046_INJECT_H_
@@ -0,0 +1,524 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_ink.c
+*@brief     Low-latency ink rendering for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_INK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Low-latency ink rendering.
+*
+* 	Calibrated touch samples inside canvas are drawn to display directly
+* 	from touch handler through XPT2046_INK_DRAW_SPAN() render hook, thus
+* 	ink does not wait for application event loop.
+*
+* 	Stroke is smoothed with quadratic midpoint curve: each new sample
+* 	draws quadratic Bezier from midpoint of previous segment to midpoint
+* 	of new segment with previous sample as control point. Curve is split
+* 	into at most XPT2046_INK_SUBDIV_MAX lines, which are drawn with
+* 	integer Bresenham kernel as horizontal spans clipped to canvas.
+*
+* 	Raw stroke points are stored into single producer, single consumer
+* 	ring buffer, so application gets same strokes for persistence.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_ink.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_INK_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Buffer size must be power of 2
+#if ( 0 != ( XPT2046_INK_BUF_SIZE & ( XPT2046_INK_BUF_SIZE - 1 )))
+	#error "XPT2046_INK_BUF_SIZE must be power of 2!"
+#endif
+
+#define XPT2046_INK_IDX_MASK				( XPT2046_INK_BUF_SIZE - 1UL )
+
+// Curve length per line piece [pixel]
+#define XPT2046_INK_SUBDIV_LEN				( 4 )
+
+// Stroke point buffer
+typedef struct
+{
+	xpt2046_ink_point_t	buf[ XPT2046_INK_BUF_SIZE ];
+	volatile uint32_t	head;		// Written by touch handler only
+	volatile uint32_t	tail;		// Written by application only
+	uint32_t			lost;		// Number of dropped points
+} xpt2046_ink_buf_t;
+
+// Ink state
+typedef struct
+{
+	xpt2046_ink_rect_t	canvas;
+	int32_t				prev_x;		// Previous sample
+	int32_t				prev_y;
+	int32_t				mid_x;		// End of drawn ink
+	int32_t				mid_y;
+	bool				stroke;		// Stroke in progress
+	volatile bool		active;
+} xpt2046_ink_t;
+
+XPT2046_MEM_CHECK( ink, XPT2046_MEM_SIZE( sizeof( xpt2046_ink_buf_t )) + XPT2046_MEM_SIZE( sizeof( xpt2046_ink_t )), XPT2046_MEM_INK );
+
+// Horizontal span under construction
+typedef struct
+{
+	int32_t		x;
+	int32_t		y;
+	int32_t		len;
+} xpt2046_ink_span_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Stroke point buffer
+static xpt2046_ink_buf_t * gp_ink_buf = NULL;
+
+// Ink state
+static xpt2046_ink_t * gp_ink = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static bool xpt2046_ink_is_inside	(const int32_t x, const int32_t y);
+static void xpt2046_ink_put			(const int32_t x, const int32_t y, const uint8_t flags);
+static void xpt2046_ink_quad		(const int32_t x0, const int32_t y0, const int32_t cx, const int32_t cy, const int32_t x1, const int32_t y1);
+static void xpt2046_ink_line		(const int32_t x0, const int32_t y0, const int32_t x1, const int32_t y1);
+static void xpt2046_ink_plot		(xpt2046_ink_span_t * const p_span, const int32_t x, const int32_t y);
+static void xpt2046_ink_flush		(xpt2046_ink_span_t * const p_span);
+static int32_t xpt2046_ink_abs		(const int32_t val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize fast-ink rendering
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_ink_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_ink_buf = xpt2046_mem_alloc( sizeof( xpt2046_ink_buf_t ));
+	gp_ink = xpt2046_mem_alloc( sizeof( xpt2046_ink_t ));
+
+	if 	(	( NULL == gp_ink_buf )
+		||	( NULL == gp_ink ))
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start fast-ink rendering
+*
+* @note		Strokes starting inside canvas are drawn. Shall be called
+* 			from same context as touch handler.
+*
+* @param[in]	p_canvas	- Pointer to canvas rectangle
+* @return 		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_ink_start(const xpt2046_ink_rect_t * const p_canvas)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( NULL != p_canvas )
+		&&	( NULL != gp_ink )
+		&&	( p_canvas->w > 0U )
+		&&	( p_canvas->h > 0U ))
+	{
+		gp_ink->active = false;
+		gp_ink->canvas = *p_canvas;
+		gp_ink->stroke = false;
+		gp_ink->active = true;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stop fast-ink rendering
+*
+* @note		Stroke in progress is finished at next touch handler call,
+* 			its tail is drawn and point with XPT2046_INK_FLAG_UP is put
+* 			to buffer.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_ink_stop(void)
+{
+	if ( NULL != gp_ink )
+	{
+		gp_ink->active = false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get stroke point
+*
+* @param[out]	p_point	- Pointer to stroke point
+* @return 		status	- eXPT2046_OK if point was taken, eXPT2046_ERROR if buffer is empty
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_ink_get(xpt2046_ink_point_t * const p_point)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	uint32_t tail;
+
+	if 	(	( NULL != p_point )
+		&&	( NULL != gp_ink_buf )
+		&&	( gp_ink_buf->tail != gp_ink_buf->head ))
+	{
+		tail = gp_ink_buf->tail;
+		*p_point = gp_ink_buf->buf[ tail & XPT2046_INK_IDX_MASK ];
+		gp_ink_buf->tail = tail + 1UL;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of stroke points dropped due to full buffer
+*
+* @return 		lost - Number of lost points
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_ink_get_lost(void)
+{
+	uint32_t lost = 0;
+
+	if ( NULL != gp_ink_buf )
+	{
+		lost = gp_ink_buf->lost;
+	}
+
+	return lost;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Render calibrated touch sample
+*
+* @note		Called by touch handler as soon as calibrated sample is
+* 			available.
+*
+* @param[in]	x		- Display x coordinate
+* @param[in]	y		- Display y coordinate
+* @param[in]	pressed	- Pressed state
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_ink_from_touch(const uint16_t x, const uint16_t y, const bool pressed)
+{
+	int32_t mid_x;
+	int32_t mid_y;
+
+	// Pen-down inside canvas -> new stroke
+	if 	(	( true == pressed )
+		&&	( false == gp_ink->stroke ))
+	{
+		if 	(	( true == gp_ink->active )
+			&&	( true == xpt2046_ink_is_inside( x, y )))
+		{
+			gp_ink->stroke = true;
+			gp_ink->prev_x = x;
+			gp_ink->prev_y = y;
+			gp_ink->mid_x = x;
+			gp_ink->mid_y = y;
+
+			xpt2046_ink_line( x, y, x, y );
+			xpt2046_ink_put( x, y, XPT2046_INK_FLAG_DOWN );
+		}
+	}
+
+	// Pen moved -> curve to midpoint of new segment
+	else if (	( true == pressed )
+			&&	( true == gp_ink->active ))
+	{
+		if (( x != gp_ink->prev_x ) || ( y != gp_ink->prev_y ))
+		{
+			mid_x = ( gp_ink->prev_x + x ) / 2;
+			mid_y = ( gp_ink->prev_y + y ) / 2;
+
+			xpt2046_ink_quad( gp_ink->mid_x, gp_ink->mid_y, gp_ink->prev_x, gp_ink->prev_y, mid_x, mid_y );
+			xpt2046_ink_put( x, y, 0U );
+
+			gp_ink->mid_x = mid_x;
+			gp_ink->mid_y = mid_y;
+			gp_ink->prev_x = x;
+			gp_ink->prev_y = y;
+		}
+	}
+
+	// Pen-up or rendering stopped -> finish stroke at last sample
+	else if ( true == gp_ink->stroke )
+	{
+		xpt2046_ink_line( gp_ink->mid_x, gp_ink->mid_y, gp_ink->prev_x, gp_ink->prev_y );
+		xpt2046_ink_put( gp_ink->prev_x, gp_ink->prev_y, XPT2046_INK_FLAG_UP );
+
+		gp_ink->stroke = false;
+	}
+	else
+	{
+		// No actions...
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if point is inside canvas
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool xpt2046_ink_is_inside(const int32_t x, const int32_t y)
+{
+	return 	(	( x >= gp_ink->canvas.x )
+			&&	( x < ( (int32_t) gp_ink->canvas.x + gp_ink->canvas.w ))
+			&&	( y >= gp_ink->canvas.y )
+			&&	( y < ( (int32_t) gp_ink->canvas.y + gp_ink->canvas.h )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Put stroke point to buffer
+*
+* @param[in]	x		- Display x coordinate
+* @param[in]	y		- Display y coordinate
+* @param[in]	flags	- Point flags
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_ink_put(const int32_t x, const int32_t y, const uint8_t flags)
+{
+	const uint32_t head = gp_ink_buf->head;
+	xpt2046_ink_point_t * p_point;
+
+	if (( head - gp_ink_buf->tail ) < XPT2046_INK_BUF_SIZE )
+	{
+		p_point = &gp_ink_buf->buf[ head & XPT2046_INK_IDX_MASK ];
+		p_point->x = (uint16_t) x;
+		p_point->y = (uint16_t) y;
+		p_point->flags = flags;
+
+		gp_ink_buf->head = head + 1UL;
+	}
+	else
+	{
+		gp_ink_buf->lost++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Draw quadratic Bezier curve
+*
+* @note		Curve is split into lines of about XPT2046_INK_SUBDIV_LEN
+* 			pixels, at most XPT2046_INK_SUBDIV_MAX.
+*
+* @param[in]	x0, y0	- Start point
+* @param[in]	cx, cy	- Control point
+* @param[in]	x1, y1	- End point
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_ink_quad(const int32_t x0, const int32_t y0, const int32_t cx, const int32_t cy, const int32_t x1, const int32_t y1)
+{
+	const int32_t len = 	xpt2046_ink_abs( cx - x0 ) + xpt2046_ink_abs( cy - y0 )
+						+ 	xpt2046_ink_abs( x1 - cx ) + xpt2046_ink_abs( y1 - cy );
+	int32_t n = len / XPT2046_INK_SUBDIV_LEN;
+	int32_t i, a, b, c, nn;
+	int32_t px = x0;
+	int32_t py = y0;
+	int32_t qx, qy;
+
+	n = ( n < 1 ) ? 1 : n;
+	n = ( n > XPT2046_INK_SUBDIV_MAX ) ? XPT2046_INK_SUBDIV_MAX : n;
+	nn = n * n;
+
+	for ( i = 1; i <= n; i++ )
+	{
+		// B(t) = (1-t)^2 * P0 + 2(1-t)t * C + t^2 * P1, t = i/n
+		a = ( n - i ) * ( n - i );
+		b = 2 * ( n - i ) * i;
+		c = i * i;
+
+		qx = (( a * x0 ) + ( b * cx ) + ( c * x1 ) + ( nn / 2 )) / nn;
+		qy = (( a * y0 ) + ( b * cy ) + ( c * y1 ) + ( nn / 2 )) / nn;
+
+		xpt2046_ink_line( px, py, qx, qy );
+
+		px = qx;
+		py = qy;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Draw line with Bresenham kernel
+*
+* @note		Consecutive pixels in same row are merged into single span.
+* 			Pixels outside canvas are skipped.
+*
+* @param[in]	x0, y0	- Start point
+* @param[in]	x1, y1	- End point
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_ink_line(const int32_t x0, const int32_t y0, const int32_t x1, const int32_t y1)
+{
+	const int32_t dx = xpt2046_ink_abs( x1 - x0 );
+	const int32_t dy = -xpt2046_ink_abs( y1 - y0 );
+	const int32_t sx = ( x0 < x1 ) ? 1 : -1;
+	const int32_t sy = ( y0 < y1 ) ? 1 : -1;
+	xpt2046_ink_span_t span = { .len = 0 };
+	int32_t err = dx + dy;
+	int32_t e2;
+	int32_t x = x0;
+	int32_t y = y0;
+	bool done = false;
+
+	while ( false == done )
+	{
+		xpt2046_ink_plot( &span, x, y );
+
+		if (( x == x1 ) && ( y == y1 ))
+		{
+			done = true;
+		}
+		else
+		{
+			e2 = 2 * err;
+
+			if ( e2 >= dy )
+			{
+				err += dy;
+				x += sx;
+			}
+
+			if ( e2 <= dx )
+			{
+				err += dx;
+				y += sy;
+			}
+		}
+	}
+
+	xpt2046_ink_flush( &span );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add pixel to span
+*
+* @param[in,out]	p_span	- Pointer to span
+* @param[in]		x, y	- Pixel
+* @return 			void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_ink_plot(xpt2046_ink_span_t * const p_span, const int32_t x, const int32_t y)
+{
+	if ( true == xpt2046_ink_is_inside( x, y ))
+	{
+		// Extend span to the right or left
+		if 	(	( p_span->len > 0 )
+			&&	( y == p_span->y )
+			&&	( x == ( p_span->x + p_span->len )))
+		{
+			p_span->len++;
+		}
+		else if (	( p_span->len > 0 )
+				&&	( y == p_span->y )
+				&&	( x == ( p_span->x - 1 )))
+		{
+			p_span->x = x;
+			p_span->len++;
+		}
+		else
+		{
+			xpt2046_ink_flush( p_span );
+
+			p_span->x = x;
+			p_span->y = y;
+			p_span->len = 1;
+		}
+	}
+	else
+	{
+		xpt2046_ink_flush( p_span );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Draw span through render hook
+*
+* @param[in,out]	p_span	- Pointer to span
+* @return 			void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_ink_flush(xpt2046_ink_span_t * const p_span)
+{
+	if ( p_span->len > 0 )
+	{
+		XPT2046_INK_DRAW_SPAN( (uint16_t) p_span->x, (uint16_t) p_span->y, (uint16_t) p_span->len );
+		p_span->len = 0;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Absolute value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t xpt2046_ink_abs(const int32_t val)
+{
+	return (( val < 0 ) ? -val : val );
+}
+
+#endif // 1 == XPT2046_INK_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
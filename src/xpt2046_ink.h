@@ -0,0 +1,69 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_ink.h
+*@brief     Low-latency ink rendering for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_INK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Low-latency ink rendering.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_INK_H_
+#define _XPT2046_INK_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Canvas rectangle in display space
+typedef struct
+{
+	uint16_t	x;		// Left [pixel]
+	uint16_t	y;		// Top [pixel]
+	uint16_t	w;		// Width [pixel]
+	uint16_t	h;		// Height [pixel]
+} xpt2046_ink_rect_t;
+
+/**
+ * 	Stroke point flags
+ */
+#define XPT2046_INK_FLAG_DOWN				( 0x01U )	// First point of stroke
+#define XPT2046_INK_FLAG_UP					( 0x02U )	// Last point of stroke
+
+// Stroke point
+typedef struct
+{
+	uint16_t	x;		// Display x [pixel]
+	uint16_t	y;		// Display y [pixel]
+	uint8_t		flags;	// XPT2046_INK_FLAG_x
+} xpt2046_ink_point_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_ink_init		(void);
+xpt2046_status_t	xpt2046_ink_start		(const xpt2046_ink_rect_t * const p_canvas);
+void				xpt2046_ink_stop		(void);
+xpt2046_status_t	xpt2046_ink_get			(xpt2046_ink_point_t * const p_point);
+uint32_t			xpt2046_ink_get_lost	(void);
+
+void				xpt2046_ink_from_touch	(const uint16_t x, const uint16_t y, const bool pressed);
+
+#endif // _XPT2046_INK_H_
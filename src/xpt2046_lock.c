@@ -0,0 +1,280 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_lock.c
+*@brief     Stationary-lock jitter suppression for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_LOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Stationary-lock jitter suppression.
+*
+* 	Output position is locked while samples stay inside deadband around
+* 	lock position. Deadband adapts to measured jitter of resting contact
+* 	and is limited to XPT2046_LOCK_DEADBAND_MIN..XPT2046_LOCK_DEADBAND_MAX.
+*
+* 	When sample leaves deadband lock is released. Output follows every
+* 	input step at once and offset between lock and input position is
+* 	halved each sample, thus release has no jump and real motion has no
+* 	added lag. Lock is
+* 	engaged again after XPT2046_LOCK_SETTLE_SAMP samples of jitter-level
+* 	movement.
+*
+* 	Stage works in raw ADC space after moving average filter and keeps
+* 	constant size state.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_lock.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_LOCK_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Jitter estimate fraction bits
+#define XPT2046_LOCK_JIT_FRAC				( 4U )
+
+// Jitter estimate averaging (1/2^N)
+#define XPT2046_LOCK_JIT_SHIFT				( 3U )
+
+// Stage state
+typedef struct
+{
+	uint16_t	lock_x;		// Lock position
+	uint16_t	lock_y;
+	int32_t		off_x;		// Output offset from input while unlocked
+	int32_t		off_y;
+	uint16_t	in_x;		// Last input
+	uint16_t	in_y;
+	uint32_t	jitter;		// Per-sample movement of resting contact [ADC, Q4]
+	uint8_t		still_cnt;	// Consecutive still samples while unlocked
+	bool		locked;
+	bool		pressed;
+} xpt2046_lock_t;
+
+XPT2046_MEM_CHECK( lock, XPT2046_MEM_SIZE( sizeof( xpt2046_lock_t )), XPT2046_MEM_LOCK );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Stage state
+static xpt2046_lock_t * gp_lock = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_lock_dist		(const uint16_t x0, const uint16_t y0, const uint16_t x1, const uint16_t y1);
+static uint32_t xpt2046_lock_deadband	(void);
+static int32_t	xpt2046_lock_decay		(const int32_t off);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize stationary lock
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_lock_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_lock = xpt2046_mem_alloc( sizeof( xpt2046_lock_t ));
+
+	if ( NULL == gp_lock )
+	{
+		status = eXPT2046_ERROR;
+	}
+	else
+	{
+		gp_lock->jitter = ( XPT2046_LOCK_DEADBAND_MIN << XPT2046_LOCK_JIT_FRAC );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Apply stationary lock
+*
+* @note		Called by touch handler after filter.
+*
+* @param[in,out]	p_X		- Pointer to raw X position
+* @param[in,out]	p_Y		- Pointer to raw Y position
+* @param[in]		pressed	- Pressed state
+* @return 			void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_lock_apply(uint16_t * const p_X, uint16_t * const p_Y, const bool pressed)
+{
+	const uint16_t X = *p_X;
+	const uint16_t Y = *p_Y;
+	uint32_t step;
+	int32_t out_x, out_y;
+
+	if ( true == pressed )
+	{
+		// Pen-down -> lock immediately
+		if ( false == gp_lock->pressed )
+		{
+			gp_lock->lock_x 	= X;
+			gp_lock->lock_y 	= Y;
+			gp_lock->locked 	= true;
+		}
+		else
+		{
+			step = xpt2046_lock_dist( X, Y, gp_lock->in_x, gp_lock->in_y );
+
+			if ( true == gp_lock->locked )
+			{
+				if ( xpt2046_lock_dist( X, Y, gp_lock->lock_x, gp_lock->lock_y ) > xpt2046_lock_deadband())
+				{
+					gp_lock->locked 		= false;
+					gp_lock->still_cnt 	= 0;
+					gp_lock->off_x 		= (int32_t) X - gp_lock->lock_x;
+					gp_lock->off_y 		= (int32_t) Y - gp_lock->lock_y;
+				}
+				else
+				{
+					// Learn jitter of resting contact
+					gp_lock->jitter += (( step << XPT2046_LOCK_JIT_FRAC ) >> XPT2046_LOCK_JIT_SHIFT );
+					gp_lock->jitter -= ( gp_lock->jitter >> XPT2046_LOCK_JIT_SHIFT );
+				}
+			}
+
+			if ( false == gp_lock->locked )
+			{
+				// Catch up with input
+				gp_lock->off_x = xpt2046_lock_decay( gp_lock->off_x );
+				gp_lock->off_y = xpt2046_lock_decay( gp_lock->off_y );
+
+				// Movement stopped -> lock again
+				if ( step <= ( xpt2046_lock_deadband() / 2U ))
+				{
+					gp_lock->still_cnt++;
+				}
+				else
+				{
+					gp_lock->still_cnt = 0;
+				}
+
+				if ( gp_lock->still_cnt >= XPT2046_LOCK_SETTLE_SAMP )
+				{
+					gp_lock->lock_x 	= (uint16_t)((int32_t) X - gp_lock->off_x );
+					gp_lock->lock_y 	= (uint16_t)((int32_t) Y - gp_lock->off_y );
+					gp_lock->locked 	= true;
+				}
+			}
+		}
+
+		gp_lock->in_x = X;
+		gp_lock->in_y = Y;
+
+		if ( true == gp_lock->locked )
+		{
+			*p_X = gp_lock->lock_x;
+			*p_Y = gp_lock->lock_y;
+		}
+		else
+		{
+			out_x = (int32_t) X - gp_lock->off_x;
+			out_y = (int32_t) Y - gp_lock->off_y;
+
+			*p_X = (uint16_t)(( out_x < 0 ) ? 0 : out_x );
+			*p_Y = (uint16_t)(( out_y < 0 ) ? 0 : out_y );
+		}
+	}
+
+	gp_lock->pressed = pressed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Chebyshev distance between two points
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_lock_dist(const uint16_t x0, const uint16_t y0, const uint16_t x1, const uint16_t y1)
+{
+	const uint32_t dx = ( x0 > x1 ) ? ( x0 - x1 ) : ( x1 - x0 );
+	const uint32_t dy = ( y0 > y1 ) ? ( y0 - y1 ) : ( y1 - y0 );
+
+	return (( dx > dy ) ? dx : dy );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Current deadband
+*
+* @return 		deadband - Deadband radius [ADC]
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_lock_deadband(void)
+{
+	uint32_t deadband = (( gp_lock->jitter * XPT2046_LOCK_JITTER_GAIN ) >> XPT2046_LOCK_JIT_FRAC );
+
+	if ( deadband < XPT2046_LOCK_DEADBAND_MIN )
+	{
+		deadband = XPT2046_LOCK_DEADBAND_MIN;
+	}
+	else if ( deadband > XPT2046_LOCK_DEADBAND_MAX )
+	{
+		deadband = XPT2046_LOCK_DEADBAND_MAX;
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return deadband;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Decay output offset
+*
+* @note		Offset is halved, small offset is closed at once.
+*
+* @param[in]	off		- Current offset
+* @return 		off		- New offset
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t xpt2046_lock_decay(const int32_t off)
+{
+	int32_t res = 0;
+
+	if (( off > 1 ) || ( off < -1 ))
+	{
+		res = off / 2;
+	}
+
+	return res;
+}
+
+#endif // 1 == XPT2046_LOCK_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,37 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_lock.h
+*@brief     Stationary-lock jitter suppression for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_LOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Stationary-lock jitter suppression.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_LOCK_H_
+#define _XPT2046_LOCK_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_lock_init	(void);
+void				xpt2046_lock_apply	(uint16_t * const p_X, uint16_t * const p_Y, const bool pressed);
+
+#endif // _XPT2046_LOCK_H_
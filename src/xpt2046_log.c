@@ -0,0 +1,323 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_log.c
+*@brief     Deferred binary log for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_LOG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Deferred binary log.
+*
+* 	Log messages are stored as fixed size binary records (message ID,
+* 	timestamp, two arguments) into ring buffer and are formatted later
+* 	on host. Storing record takes constant and short time, thus debug
+* 	build keeps timing of release build.
+*
+* 	Ring is multiple producer, single consumer and lock-free. Producer
+* 	reserves slot with atomic fetch and add (XPT2046_LOG_FETCH_ADD) and
+* 	marks slot with sequence number when record is complete. Consumer
+* 	accepts slot only with expected sequence number, which is checked
+* 	before and after copy. On overflow oldest records are overwritten
+* 	and consumer reports number of lost records.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_log.h"
+#include "../../xpt2046_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == XPT2046_LOG_EN )
+
+// Ring size must be power of 2
+#if ( 0 != ( XPT2046_LOG_SIZE & ( XPT2046_LOG_SIZE - 1 )))
+	#error "XPT2046_LOG_SIZE must be power of 2!"
+#endif
+
+#define XPT2046_LOG_IDX_MASK				( XPT2046_LOG_SIZE - 1UL )
+
+// Ring slot
+typedef struct
+{
+	uint32_t	seq;		// Record index + 1, 0 while being written
+	uint32_t	timestamp;
+	uint32_t	arg[2];
+	uint8_t		id;
+} xpt2046_log_slot_t;
+
+// Log ring
+typedef struct
+{
+	volatile xpt2046_log_slot_t	buf[ XPT2046_LOG_SIZE ];
+	volatile uint32_t			head;			// Next record index to reserve
+	uint32_t					tail;			// Written by consumer only
+	uint32_t					lost;			// Total lost records
+	uint32_t					lost_pending;	// Lost records not yet reported
+} xpt2046_log_ring_t;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == XPT2046_LOG_EN )
+
+	// Log ring
+	static xpt2046_log_ring_t g_log;
+
+#elif ( 1 == XPT2046_DEBUG_EN )
+
+	#define XPT2046_LOG_FMT_ENTRY( id, fmt )	fmt,
+
+	// Format strings for synchronous debug print
+	const char * const gc_xpt2046_log_fmt[ eXPT2046_LOG_NUM_OF ] =
+	{
+		XPT2046_LOG_TABLE( XPT2046_LOG_FMT_ENTRY )
+	};
+
+#endif
+
+#if ( 1 == XPT2046_LOG_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_log_put_u32(uint8_t * const p_buf, const uint32_t val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store log record
+*
+* @note		Can be called from any context, including interrupts. Does
+* 			not block.
+*
+* @param[in]	id	- Message ID
+* @param[in]	a0	- First argument
+* @param[in]	a1	- Second argument
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_log_put(const xpt2046_log_id_t id, const uint32_t a0, const uint32_t a1)
+{
+	const uint32_t idx = XPT2046_LOG_FETCH_ADD( &g_log.head, 1UL );
+	volatile xpt2046_log_slot_t * const p_slot = &g_log.buf[ idx & XPT2046_LOG_IDX_MASK ];
+
+	// Invalidate slot while written
+	p_slot->seq = 0;
+
+	p_slot->timestamp 	= XPT2046_GET_SYSTICK();
+	p_slot->arg[0] 		= a0;
+	p_slot->arg[1] 		= a1;
+	p_slot->id 			= (uint8_t) id;
+
+	// Publish
+	p_slot->seq = idx + 1UL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get oldest log record
+*
+* @note		Shall be called from single context. Lost records are
+* 			reported first as eXPT2046_LOG_LOST record.
+*
+* @param[out]	p_rec	- Pointer to record
+* @return 		status	- eXPT2046_OK if record was taken, eXPT2046_ERROR if log is empty
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_log_get(xpt2046_log_rec_t * const p_rec)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+	volatile xpt2046_log_slot_t * p_slot;
+	uint32_t head;
+	uint32_t seq;
+	bool busy = true;
+
+	if ( NULL != p_rec )
+	{
+		while ( true == busy )
+		{
+			head = g_log.head;
+
+			// Skip overwritten records
+			if (( head - g_log.tail ) > XPT2046_LOG_SIZE )
+			{
+				g_log.lost += ( head - XPT2046_LOG_SIZE - g_log.tail );
+				g_log.lost_pending += ( head - XPT2046_LOG_SIZE - g_log.tail );
+				g_log.tail = head - XPT2046_LOG_SIZE;
+			}
+
+			// Report lost records
+			if ( g_log.lost_pending > 0U )
+			{
+				p_rec->timestamp 	= XPT2046_GET_SYSTICK();
+				p_rec->arg[0] 		= g_log.lost_pending;
+				p_rec->arg[1] 		= 0;
+				p_rec->id 			= (uint8_t) eXPT2046_LOG_LOST;
+
+				g_log.lost_pending = 0;
+				status = eXPT2046_OK;
+				busy = false;
+			}
+
+			// Empty
+			else if ( head == g_log.tail )
+			{
+				busy = false;
+			}
+
+			else
+			{
+				p_slot = &g_log.buf[ g_log.tail & XPT2046_LOG_IDX_MASK ];
+				seq = p_slot->seq;
+
+				if ( seq == ( g_log.tail + 1UL ))
+				{
+					p_rec->timestamp 	= p_slot->timestamp;
+					p_rec->arg[0] 		= p_slot->arg[0];
+					p_rec->arg[1] 		= p_slot->arg[1];
+					p_rec->id 			= p_slot->id;
+
+					// Slot not overwritten during copy
+					if ( seq == p_slot->seq )
+					{
+						g_log.tail++;
+						status = eXPT2046_OK;
+						busy = false;
+					}
+				}
+
+				// Oldest record still being written
+				else if ((int32_t)( seq - ( g_log.tail + 1UL )) < 0 )
+				{
+					busy = false;
+				}
+
+				// Overwritten, skip on next pass
+				else
+				{
+					// No actions...
+				}
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read serialized log records
+*
+* @note		Only whole records are written to buffer. Shall be called
+* 			from single context, e.g. low priority task sending log
+* 			over debug port.
+*
+* @param[out]	p_buf	- Pointer to buffer
+* @param[in]	size	- Size of buffer in bytes
+* @param[out]	p_len	- Number of bytes written
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_log_read(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	xpt2046_log_rec_t rec;
+	uint8_t * p_rec;
+	uint8_t chk;
+	uint32_t len = 0;
+	uint32_t i;
+
+	if 	(	( NULL != p_buf )
+		&&	( NULL != p_len ))
+	{
+		while 	(	(( size - len ) >= XPT2046_LOG_REC_SIZE )
+				&&	( eXPT2046_OK == xpt2046_log_get( &rec )))
+		{
+			p_rec = &p_buf[ len ];
+
+			xpt2046_log_put_u32( &p_rec[4],  rec.timestamp );
+			xpt2046_log_put_u32( &p_rec[8],  rec.arg[0] );
+			xpt2046_log_put_u32( &p_rec[12], rec.arg[1] );
+
+			chk = 0;
+			for ( i = 4; i < XPT2046_LOG_REC_SIZE; i++ )
+			{
+				chk ^= p_rec[i];
+			}
+
+			p_rec[0] = XPT2046_LOG_SYNC;
+			p_rec[1] = rec.id;
+			p_rec[2] = (uint8_t) ~rec.id;
+			p_rec[3] = chk;
+
+			len += XPT2046_LOG_REC_SIZE;
+		}
+
+		*p_len = len;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of records lost due to full log
+*
+* @return 		lost - Number of lost records
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_log_get_lost(void)
+{
+	return g_log.lost;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store 32-bit value to buffer in little endian
+*
+* @param[out]	p_buf	- Pointer to buffer
+* @param[in]	val		- Value
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_log_put_u32(uint8_t * const p_buf, const uint32_t val)
+{
+	p_buf[0] = (uint8_t)( val );
+	p_buf[1] = (uint8_t)( val >> 8 );
+	p_buf[2] = (uint8_t)( val >> 16 );
+	p_buf[3] = (uint8_t)( val >> 24 );
+}
+
+#endif // 1 == XPT2046_LOG_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
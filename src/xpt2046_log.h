@@ -0,0 +1,112 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_log.h
+*@brief     Deferred binary log for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_LOG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Deferred binary log.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_LOG_H_
+#define _XPT2046_LOG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Log message table
+ *
+ * 	Format strings are never compiled into target when deferred log is
+ * 	enabled, they are read from this table by host decoder
+ * 	(tools/log/xpt2046_log_decode.py). Each message takes up to two
+ * 	32-bit arguments.
+ *
+ * 	NOTE: Append new messages at the end to keep decoding of old logs!
+ */
+#define XPT2046_LOG_TABLE( X )																		\
+	X( eXPT2046_LOG_LOST,				"%u log records lost" )									\
+	X( eXPT2046_LOG_NOT_INIT,			"Module not initialized!" )								\
+	X( eXPT2046_LOG_FSM_INVALID,		"Invalid FSM state %u..." )								\
+	X( eXPT2046_LOG_CAL_START,			"Calibration started" )									\
+	X( eXPT2046_LOG_CAL_DONE,			"Calibration done, divisor %d" )						\
+	X( eXPT2046_LOG_CAL_SET,			"Calibration factors set, divisor %d" )
+
+#define XPT2046_LOG_ID_ENUM( id, fmt )		id,
+
+// Log message IDs
+typedef enum
+{
+	XPT2046_LOG_TABLE( XPT2046_LOG_ID_ENUM )
+
+	eXPT2046_LOG_NUM_OF,
+} xpt2046_log_id_t;
+
+// Log record
+typedef struct
+{
+	uint32_t	timestamp;	// [ms]
+	uint32_t	arg[2];
+	uint8_t		id;			// xpt2046_log_id_t
+} xpt2046_log_rec_t;
+
+/**
+ * 	Serialized record layout (little endian, 16 bytes)
+ *
+ * 		[0]		Sync XPT2046_LOG_SYNC
+ * 		[1]		Message ID
+ * 		[2]		Inverted message ID
+ * 		[3]		XOR of bytes 4..15
+ * 		[4..7]	Timestamp [ms]
+ * 		[8..11]	Argument 0
+ * 		[12..15]Argument 1
+ */
+#define XPT2046_LOG_SYNC					( 0xA5U )
+#define XPT2046_LOG_REC_SIZE				( 16U )
+
+/**
+ * 	Log message
+ *
+ * 	Deferred log stores binary record from any context without blocking.
+ * 	Without deferred log message is printed synchronously to debug port.
+ */
+#if ( 1 == XPT2046_LOG_EN )
+	#define XPT2046_LOG( id, a0, a1 )		xpt2046_log_put(( id ), (uint32_t)( a0 ), (uint32_t)( a1 ))
+#else
+	#define XPT2046_LOG( id, a0, a1 )		XPT2046_DBG_PRINT( gc_xpt2046_log_fmt[( id )], ( a0 ), ( a1 ))
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+#if ( 0 == XPT2046_LOG_EN )
+	extern const char * const gc_xpt2046_log_fmt[ eXPT2046_LOG_NUM_OF ];
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+void				xpt2046_log_put			(const xpt2046_log_id_t id, const uint32_t a0, const uint32_t a1);
+xpt2046_status_t	xpt2046_log_get			(xpt2046_log_rec_t * const p_rec);
+xpt2046_status_t	xpt2046_log_read		(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len);
+uint32_t			xpt2046_log_get_lost	(void);
+
+#endif // _XPT2046_LOG_H_
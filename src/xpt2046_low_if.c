@@ -22,6 +22,7 @@
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
 #include "xpt2046_low_if.h"
+#include "xpt2046_par.h"
 #include "../../xpt2046_cfg.h"
 #include "../../xpt2046_if.h"
 
@@ -46,20 +47,28 @@ typedef union
 	uint8_t U;
 } xpt2046_control_t;
 
+// Size of single conversion frame (24 clocks)
+#define XPT2046_LOW_IF_FRAME_SIZE		( 3U )
+
 // Conversion result
 typedef union
 {
+	// 12-bit conversion
 	struct
 	{
 		uint16_t res0	 	: 3;
-#if ( 0 == XPT2046_ADC_RESOLUTION )
 		uint16_t adc_result	: 12;	// ADC result
 		uint16_t res1		: 1;
-#else
-		uint16_t adc_result	: 8;	// ADC result
-		uint16_t res1		: 7;
-#endif
 	} bits;
+
+	// 8-bit conversion
+	struct
+	{
+		uint16_t res0	 	: 7;
+		uint16_t adc_result	: 8;	// ADC result
+		uint16_t res1		: 1;
+	} bits_8;
+
 	uint16_t U;
 } xpt2046_result_t;
 
@@ -70,6 +79,8 @@ typedef union
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
+static void 	xpt2046_low_if_assemble	(uint8_t * const p_frame, const xpt2046_addr_t addr, const xpt2046_pd_t pd_mode, const xpt2046_start_t start, const bool single_ended, uint8_t * const p_mode);
+static uint16_t	xpt2046_low_if_parse	(const uint8_t * const p_frame, const uint8_t mode);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -88,40 +99,146 @@ typedef union
 ////////////////////////////////////////////////////////////////////////////////
 xpt2046_status_t xpt2046_low_if_exchange(const xpt2046_addr_t addr, const xpt2046_pd_t pd_mode, const xpt2046_start_t start, uint16_t * const p_adc_result)
 {
+	uint8_t rx_data[ XPT2046_LOW_IF_FRAME_SIZE ];
+	uint8_t tx_data[ XPT2046_LOW_IF_FRAME_SIZE ];
 	xpt2046_status_t status = eXPT2046_OK;
-	xpt2046_control_t control;
-	xpt2046_result_t result;
-	uint8_t rx_data[3];
-	uint8_t tx_data[3];
-	uint16_t rx_data_w;
+	uint8_t mode;
 
 	// Assemble frame
+	xpt2046_low_if_assemble( &tx_data[0], addr, pd_mode, start, false, &mode );
+
+	// Interface with the device
+	status = xpt2046_if_spi_transmit_receive((uint8_t*) &tx_data, (uint8_t*) &rx_data, XPT2046_LOW_IF_FRAME_SIZE, ( eSPI_CS_LOW_ON_ENTRY | eSPI_CS_HIGH_ON_EXIT ));
+
+	if ( eXPT2046_OK == status )
+	{
+		*p_adc_result = xpt2046_low_if_parse( &rx_data[0], mode );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Low level interface burst exchange
+*
+* @note		All conversions are done within single SPI transfer with
+* 			chip select held low. Each conversion takes 24 clocks, as
+* 			with single exchange.
+*
+* @param[in]	p_cmd 			- Pointer to conversion commands
+* @param[in]	num 			- Number of conversions
+* @param[out]	p_adc_result 	- Pointer to measurement results
+* @return 		status 			- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_low_if_exchange_burst(const xpt2046_low_if_cmd_t * const p_cmd, const uint32_t num, uint16_t * const p_adc_result)
+{
+	uint8_t rx_data[ XPT2046_LOW_IF_FRAME_SIZE * XPT2046_LOW_IF_BURST_MAX ];
+	uint8_t tx_data[ XPT2046_LOW_IF_FRAME_SIZE * XPT2046_LOW_IF_BURST_MAX ];
+	uint8_t mode[ XPT2046_LOW_IF_BURST_MAX ];
+	xpt2046_status_t status = eXPT2046_OK;
+	uint32_t i;
+
+	if (( num > 0 ) && ( num <= XPT2046_LOW_IF_BURST_MAX ))
+	{
+		// Assemble frames
+		for ( i = 0; i < num; i++ )
+		{
+			xpt2046_low_if_assemble( &tx_data[ i * XPT2046_LOW_IF_FRAME_SIZE ], p_cmd[i].addr, p_cmd[i].pd_mode, eXPT2046_START_ON, p_cmd[i].single_ended, &mode[i] );
+		}
+
+		// Interface with the device
+		status = xpt2046_if_spi_transmit_receive((uint8_t*) &tx_data, (uint8_t*) &rx_data, ( num * XPT2046_LOW_IF_FRAME_SIZE ), ( eSPI_CS_LOW_ON_ENTRY | eSPI_CS_HIGH_ON_EXIT ));
+
+		if ( eXPT2046_OK == status )
+		{
+			for ( i = 0; i < num; i++ )
+			{
+				p_adc_result[i] = xpt2046_low_if_parse( &rx_data[ i * XPT2046_LOW_IF_FRAME_SIZE ], mode[i] );
+			}
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Assemble conversion frame
+*
+* @param[out]	p_frame 	- Pointer to frame
+* @param[in]	addr 		- Address of operation
+* @param[in]	pd_mode 	- Power down mode
+* @param[in]	start 		- Start bit
+* @param[in]	single_ended- Force single ended reference mode
+* @param[out]	p_mode 		- Pointer to used ADC resolution
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_low_if_assemble(uint8_t * const p_frame, const xpt2046_addr_t addr, const xpt2046_pd_t pd_mode, const xpt2046_start_t start, const bool single_ended, uint8_t * const p_mode)
+{
+	xpt2046_control_t control;
+
 	control.U = 0;
 	control.bits.source 	= start;
 	control.bits.addr 		= addr;
-	control.bits.mode 		= XPT2046_ADC_RESOLUTION;
-	control.bits.ser_dfr 	= XPT2046_REF_MODE;
+	control.bits.mode 		= (uint8_t) xpt2046_par_get_value( eXPT2046_PAR_ADC_RESOLUTION );
+	control.bits.ser_dfr 	= (uint8_t) xpt2046_par_get_value( eXPT2046_PAR_REF_MODE );
+
+	if ( true == single_ended )
+	{
+		control.bits.ser_dfr = XPT2046_REF_MODE_SINGLE_ENDED;
+	}
 	control.bits.pd			= pd_mode;
 
-	// Copy assemble frame
-	tx_data[0] = control.U;
+	// Control byte followed by two clocking bytes
+	p_frame[0] = control.U;
+	p_frame[1] = 0U;
+	p_frame[2] = 0U;
 
-	// Interface with the device
-	status = xpt2046_if_spi_transmit_receive((uint8_t*) &tx_data, (uint8_t*) &rx_data, 3U, ( eSPI_CS_LOW_ON_ENTRY | eSPI_CS_HIGH_ON_EXIT ));
+	*p_mode = control.bits.mode;
+}
 
-	if ( eXPT2046_OK == status )
-	{
-		// NOTE: Big endian
-		rx_data_w = ( rx_data[1] << 8 ) | ( rx_data[2] );
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Parse conversion frame
+*
+* @note		8-bit result is scaled to 12-bit range, thus calibration,
+* 			pressure references and other raw thresholds stay valid
+* 			when resolution is changed at run-time.
+*
+* @param[in]	p_frame 	- Pointer to received frame
+* @param[in]	mode 		- ADC resolution
+* @return 		adc_result	- Conversion result
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_low_if_parse(const uint8_t * const p_frame, const uint8_t mode)
+{
+	xpt2046_result_t result;
+	uint16_t rx_data_w;
+	uint16_t adc_result;
 
-		// Parse received frame
-		memcpy( &result.U, &rx_data_w, 2U );
+	// NOTE: Big endian
+	rx_data_w = ( p_frame[1] << 8 ) | ( p_frame[2] );
 
-		// Set result
-		*p_adc_result = result.bits.adc_result;
+	// Parse received frame
+	memcpy( &result.U, &rx_data_w, 2U );
+
+	if ( XPT2046_ADC_8_BIT == mode )
+	{
+		adc_result = (uint16_t)( result.bits_8.adc_result << 4U );
+	}
+	else
+	{
+		adc_result = result.bits.adc_result;
 	}
 
-	return status;
+	return adc_result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +264,23 @@ xpt2046_int_t xpt2046_low_if_get_int(void)
 	return touch_int;
 }
 
+#if ( 1 == XPT2046_CLK_TUNE_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Set SPI clock
+	*
+	* @param[in]	idx		- Clock setting of interface, 0 is slowest
+	* @return 		status	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	xpt2046_status_t xpt2046_low_if_set_clk(const uint8_t idx)
+	{
+		return xpt2046_if_spi_set_clk( idx );
+	}
+
+#endif // 1 == XPT2046_CLK_TUNE_EN
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -24,6 +24,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
 #include "xpt2046.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -68,10 +69,23 @@ typedef enum
 	eXPT2046_START_ON
 } xpt2046_start_t;
 
+// Conversion command
+typedef struct
+{
+	xpt2046_addr_t	addr;
+	xpt2046_pd_t	pd_mode;
+	bool			single_ended;	// Force single ended mode (auxiliary channels)
+} xpt2046_low_if_cmd_t;
+
+// Max. number of conversions in single burst
+#define XPT2046_LOW_IF_BURST_MAX		( 8U )
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
 xpt2046_status_t 	xpt2046_low_if_exchange	(const xpt2046_addr_t addr, const xpt2046_pd_t pd_mode, const xpt2046_start_t start, uint16_t * const p_adc_result);
+xpt2046_status_t	xpt2046_low_if_exchange_burst	(const xpt2046_low_if_cmd_t * const p_cmd, const uint32_t num, uint16_t * const p_adc_result);
 xpt2046_int_t 		xpt2046_low_if_get_int	(void);
+xpt2046_status_t	xpt2046_low_if_set_clk	(const uint8_t idx);
 
 #endif // _XPT2046_LOW_IF_H_
@@ -0,0 +1,183 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_mem.c
+*@brief     Driver state memory for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_MEM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Driver state memory.
+*
+* 	All run-time state of driver is carved from single memory block at
+* 	initialization with bump allocator. Block can be given by application
+* 	(XPT2046_MEM_EXT_EN), e.g. to place driver state into tightly coupled
+* 	memory, otherwise internal static block is used.
+*
+* 	Modules allocate their state in xpt2046_init() in order of use by
+* 	touch handler, thus state of hot path lies together.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Memory block
+typedef struct
+{
+	uint8_t *	p_base;
+	uint32_t	size;
+	uint32_t	used;
+} xpt2046_mem_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 0 == XPT2046_MEM_EXT_EN )
+
+	// Internal memory block
+	static uint64_t g_mem_block[ XPT2046_MEM_REQUIRED / sizeof( uint64_t ) ];
+
+	// Memory block
+	static xpt2046_mem_t g_mem =
+	{
+		.p_base = (uint8_t*) g_mem_block,
+		.size 	= sizeof( g_mem_block ),
+		.used 	= 0,
+	};
+
+#else
+
+	// Memory block
+	static xpt2046_mem_t g_mem =
+	{
+		.p_base = NULL,
+		.size 	= 0,
+		.used 	= 0,
+	};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Assign memory block for driver state
+*
+* @note		Shall be called before xpt2046_init(). Block must be aligned
+* 			to XPT2046_MEM_ALIGN and stay valid for lifetime of driver.
+*
+* @param[in]	p_mem	- Pointer to memory block
+* @param[in]	size	- Size of block in bytes, at least XPT2046_MEM_REQUIRED
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_mem_assign(void * const p_mem, const uint32_t size)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( NULL != p_mem )
+		&&	( 0U == ((uintptr_t) p_mem & ( XPT2046_MEM_ALIGN - 1U )))
+		&&	( size >= XPT2046_MEM_REQUIRED ))
+	{
+		g_mem.p_base 	= (uint8_t*) p_mem;
+		g_mem.size 		= size;
+		g_mem.used 		= 0;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of used bytes of memory block
+*
+* @return 		used - Allocated bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_mem_get_used(void)
+{
+	return g_mem.used;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release all allocations and clear memory block
+*
+* @note		Called by xpt2046_init() before modules allocate their state.
+*
+* @return 		status - eXPT2046_ERROR if memory block is not assigned
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_mem_reset(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if ( NULL != g_mem.p_base )
+	{
+		memset( g_mem.p_base, 0, g_mem.size );
+		g_mem.used = 0;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Allocate zeroed memory from block
+*
+* @note		Memory is never freed, only at re-initialization.
+*
+* @param[in]	size	- Size in bytes
+* @return 		p_mem	- Pointer to memory, NULL if block is exhausted
+*/
+////////////////////////////////////////////////////////////////////////////////
+void * xpt2046_mem_alloc(const uint32_t size)
+{
+	void * p_mem = NULL;
+	const uint32_t size_aligned = XPT2046_MEM_SIZE( size );
+
+	if 	(	( NULL != g_mem.p_base )
+		&&	( size_aligned <= ( g_mem.size - g_mem.used )))
+	{
+		p_mem = (void*) &g_mem.p_base[ g_mem.used ];
+		g_mem.used += size_aligned;
+	}
+
+	return p_mem;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
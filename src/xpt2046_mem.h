@@ -0,0 +1,163 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_mem.h
+*@brief     Driver state memory for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_MEM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Driver state memory.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_MEM_H_
+#define _XPT2046_MEM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "xpt2046.h"
+#include "xpt2046_par.h"
+#include "xpt2046_pressure.h"
+#include "xpt2046_evt.h"
+#include "xpt2046_ink.h"
+#include "xpt2046_inject.h"
+#include "xpt2046_shape.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Allocation alignment
+ */
+#define XPT2046_MEM_ALIGN					( 8U )
+#define XPT2046_MEM_SIZE(size)				(((uint32_t)( size ) + ( XPT2046_MEM_ALIGN - 1U )) & ~( XPT2046_MEM_ALIGN - 1U ))
+
+/**
+ * 	Memory needed by each part of driver in bytes
+ *
+ * 	NOTE: These are upper bounds for any target ABI, each module checks
+ * 	its state against its bound at compile time.
+ *
+ * 	NOTE: Sample buffer of MCU ADC backend stays in static memory as it
+ * 	can be DMA target, which tightly coupled memory might not be.
+ */
+
+// Touch data and acquisition history
+#define XPT2046_MEM_CORE					( XPT2046_MEM_SIZE( 24U ) + XPT2046_MEM_SIZE( 16U ))
+
+#if ( 1 == XPT2046_FILTER_EN )
+	#define XPT2046_MEM_FILTER				( XPT2046_MEM_SIZE(( 3U * (( 2U * XPT2046_FILTER_WIN_SAMP ) + 8U )) + 8U ))
+#else
+	#define XPT2046_MEM_FILTER				( 0U )
+#endif
+
+// Run-time calibration data and FSM
+#if (( 0 == XPT2046_CAL_BAKED_EN ) || ( 1 == XPT2046_CAL_BAKED_OVERRIDE_EN ))
+	#define XPT2046_MEM_CAL					( XPT2046_MEM_SIZE( 196U ) + XPT2046_MEM_SIZE( 24U ))
+#else
+	#define XPT2046_MEM_CAL					( 0U )
+#endif
+
+// Parameter registry
+#define XPT2046_MEM_PAR						( XPT2046_MEM_SIZE( 9U * eXPT2046_PAR_NUM_OF ))
+
+#if ( 1 == XPT2046_PRESSURE_EN )
+	#define XPT2046_MEM_PRESSURE			( XPT2046_MEM_SIZE(( 2U * XPT2046_PRESSURE_LUT_SIZE ) + 8U ))
+#else
+	#define XPT2046_MEM_PRESSURE			( 0U )
+#endif
+
+#if ( 1 == XPT2046_CLASS_EN )
+	#define XPT2046_MEM_CLASS				( XPT2046_MEM_SIZE( 24U ))
+#else
+	#define XPT2046_MEM_CLASS				( 0U )
+#endif
+
+#if ( 1 == XPT2046_LOCK_EN )
+	#define XPT2046_MEM_LOCK				( XPT2046_MEM_SIZE( 32U ))
+#else
+	#define XPT2046_MEM_LOCK				( 0U )
+#endif
+
+#if ( 1 == XPT2046_ROI_EN )
+	#define XPT2046_MEM_ROI					( XPT2046_MEM_SIZE(( 16U * XPT2046_ROI_MAX ) + 16U ))
+#else
+	#define XPT2046_MEM_ROI					( 0U )
+#endif
+
+#if ( 1 == XPT2046_EVT_EN )
+	#define XPT2046_MEM_EVT					( XPT2046_MEM_SIZE(( XPT2046_EVT_QUEUE_SIZE * sizeof( xpt2046_evt_t )) + 16U ) + XPT2046_MEM_SIZE( 8U ))
+#else
+	#define XPT2046_MEM_EVT					( 0U )
+#endif
+
+#if ( 1 == XPT2046_STREAM_EN )
+	#define XPT2046_MEM_STREAM				( XPT2046_MEM_SIZE( 24U ))
+#else
+	#define XPT2046_MEM_STREAM				( 0U )
+#endif
+
+#if ( 1 == XPT2046_INK_EN )
+	#define XPT2046_MEM_INK					( XPT2046_MEM_SIZE(( XPT2046_INK_BUF_SIZE * sizeof( xpt2046_ink_point_t )) + 16U ) + XPT2046_MEM_SIZE( 32U ))
+#else
+	#define XPT2046_MEM_INK					( 0U )
+#endif
+
+#if ( 1 == XPT2046_HEATMAP_EN )
+	#define XPT2046_MEM_HEATMAP				( XPT2046_MEM_SIZE(( 6U * XPT2046_HEATMAP_COLS * XPT2046_HEATMAP_ROWS ) + 24U ))
+#else
+	#define XPT2046_MEM_HEATMAP				( 0U )
+#endif
+
+#if ( 1 == XPT2046_SHAPE_EN )
+	#define XPT2046_MEM_SHAPE				( XPT2046_MEM_SIZE(( 6U * XPT2046_SHAPE_BUF_SIZE ) + ( 2U * XPT2046_SHAPE_POINTS ) + 64U ))
+#else
+	#define XPT2046_MEM_SHAPE				( 0U )
+#endif
+
+#if ( 1 == XPT2046_INJECT_EN )
+	#define XPT2046_MEM_INJECT				( XPT2046_MEM_SIZE( eXPT2046_INJECT_NUM_OF * (( XPT2046_INJECT_QUEUE_SIZE * sizeof( xpt2046_inject_samp_t )) + 8U )) + XPT2046_MEM_SIZE( sizeof( xpt2046_inject_samp_t ) + 48U ))
+#else
+	#define XPT2046_MEM_INJECT				( 0U )
+#endif
+
+#if ( 1 == XPT2046_NOISE_EN )
+	#define XPT2046_MEM_NOISE				( XPT2046_MEM_SIZE(( 256U * 8U ) + 16U ) + XPT2046_MEM_SIZE( 16U ))
+#else
+	#define XPT2046_MEM_NOISE				( 0U )
+#endif
+
+/**
+ * 	Size of memory block needed by driver in bytes
+ */
+#define XPT2046_MEM_REQUIRED				(	XPT2046_MEM_CORE + XPT2046_MEM_FILTER + XPT2046_MEM_CAL + XPT2046_MEM_PAR		\
+											+	XPT2046_MEM_PRESSURE + XPT2046_MEM_CLASS + XPT2046_MEM_LOCK + XPT2046_MEM_ROI	\
+											+	XPT2046_MEM_EVT + XPT2046_MEM_INK + XPT2046_MEM_HEATMAP + XPT2046_MEM_INJECT	\
+											+	XPT2046_MEM_NOISE + XPT2046_MEM_STREAM + XPT2046_MEM_SHAPE )
+
+/**
+ * 	Compile time check that module state fits into its bound
+ */
+#define XPT2046_MEM_CHECK(name, used, bound)	typedef char xpt2046_mem_check_##name[ (( used ) <= ( bound )) ? 1 : -1 ]
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_mem_assign		(void * const p_mem, const uint32_t size);
+uint32_t			xpt2046_mem_get_used	(void);
+
+xpt2046_status_t	xpt2046_mem_reset		(void);
+void *				xpt2046_mem_alloc		(const uint32_t size);
+
+#endif // _XPT2046_MEM_H_
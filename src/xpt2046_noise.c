@@ -0,0 +1,604 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_noise.c
+*@brief     Interference analyzer and acquisition phase sync for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_NOISE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Interference analyzer and acquisition phase sync.
+*
+* 	Periodic interference (backlight PWM, display refresh) is coupled
+* 	into panel and shows as noise on touch samples. Analyzer captures
+* 	burst of still-hold samples at XPT2046_NOISE_SAMP_PERIOD_US and runs
+* 	fixed-point Goertzel bank over all spectrum bins to find strongest
+* 	interference frequencies.
+*
+* 	Period of strongest interference is then refined by folding samples
+* 	over candidate periods (epoch folding) and samples are binned by
+* 	phase. Phase bin with lowest variance is quietest sampling instant,
+* 	e.g. plateau of PWM away from its edges.
+*
+* 	When period is short enough, touch acquisition is synchronized to
+* 	that phase by waiting up to one period before each acquisition.
+* 	Noise is reduced without any additional filter lag.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_noise.h"
+#include "xpt2046_mem.h"
+#include "xpt2046_backend.h"
+#include "xpt2046_backend_adc.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_NOISE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of captured samples
+// NOTE: Fixed due to sine table resolution!
+#define XPT2046_NOISE_SAMP_NUM				( 256U )
+
+// Number of phase bins within interference period
+#define XPT2046_NOISE_PHASE_BINS			( 8U )
+
+// Number of candidate periods for period refinement
+#define XPT2046_NOISE_FOLD_STEPS			( 64U )
+
+// Goertzel coefficient fraction bits
+#define XPT2046_NOISE_COEF_FRAC				( 14U )
+
+// Sample capture
+typedef struct
+{
+	uint16_t	x[ XPT2046_NOISE_SAMP_NUM ];
+	uint16_t	y[ XPT2046_NOISE_SAMP_NUM ];
+	uint32_t	t[ XPT2046_NOISE_SAMP_NUM ];	// Relative to t_start [us]
+	uint32_t	t_start;						// Capture start [us]
+	int32_t		x_mean;
+	int32_t		y_mean;
+} xpt2046_noise_capture_t;
+
+// Phase bin statistics
+typedef struct
+{
+	int64_t		sum;
+	uint64_t	sum_sq;
+	uint32_t	cnt;
+} xpt2046_noise_bin_t;
+
+// Acquisition sync
+typedef struct
+{
+	uint32_t	period;		// [us], 0 - sync disabled
+	uint32_t	phase;		// [us]
+	uint32_t	t_ref;		// Start of period [us]
+	uint32_t	t_anchor;	// Phase reference [us]
+} xpt2046_noise_sync_t;
+
+XPT2046_MEM_CHECK( noise, XPT2046_MEM_SIZE( sizeof( xpt2046_noise_capture_t )) + XPT2046_MEM_SIZE( sizeof( xpt2046_noise_sync_t )), XPT2046_MEM_NOISE );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Backend
+static const xpt2046_backend_t * const gp_backend = &XPT2046_BACKEND;
+
+// Sample capture
+static xpt2046_noise_capture_t * gp_capture = NULL;
+
+// Acquisition sync
+static xpt2046_noise_sync_t * gp_sync = NULL;
+
+// First quadrant of sin(2*pi*i/256) in Q15
+static const int16_t gi16_sin_q15[] =
+{
+	0, 		804, 	1608, 	2410, 	3212, 	4011, 	4808, 	5602,
+	6393, 	7179, 	7962, 	8739, 	9512, 	10278, 	11039, 	11793,
+	12539, 	13279, 	14010, 	14732, 	15446, 	16151, 	16846, 	17530,
+	18204, 	18868, 	19519, 	20159, 	20787, 	21403, 	22005, 	22594,
+	23170, 	23731, 	24279, 	24811, 	25329, 	25832, 	26319, 	26790,
+	27245, 	27683, 	28105, 	28510, 	28898, 	29268, 	29621, 	29956,
+	30273, 	30571, 	30852, 	31113, 	31356, 	31580, 	31785, 	31971,
+	32137, 	32285, 	32412, 	32521, 	32609, 	32678, 	32728, 	32757,
+	32767,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t	xpt2046_noise_capture		(void);
+static uint64_t			xpt2046_noise_goertzel		(const uint32_t k);
+static uint64_t			xpt2046_noise_fold			(const uint32_t period, xpt2046_noise_bin_t * const p_bins);
+static uint64_t			xpt2046_noise_bin_var		(const xpt2046_noise_bin_t * const p_bin);
+static int32_t			xpt2046_noise_cos_q15		(const uint32_t k);
+static uint32_t			xpt2046_noise_isqrt			(const uint64_t val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize interference analyzer
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_noise_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_capture = xpt2046_mem_alloc( sizeof( xpt2046_noise_capture_t ));
+	gp_sync = xpt2046_mem_alloc( sizeof( xpt2046_noise_sync_t ));
+
+	if 	(	( NULL == gp_capture )
+		||	( NULL == gp_sync ))
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Analyze periodic interference and sync acquisition to it
+*
+* @note		Blocking for XPT2046_NOISE_SAMP_PERIOD_US * 256 plus analysis.
+* 			Panel must be held still (e.g. weighted stylus) during
+* 			capture. Shall be called from same context as touch handler.
+*
+* 			Acquisition is synchronized when strongest interference
+* 			period is below XPT2046_NOISE_SYNC_MAX_US and sampling at
+* 			quietest phase is less noisy than unsynchronized sampling.
+*
+* @param[out]	p_result	- Pointer to analysis result
+* @return 		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_noise_analyze(xpt2046_noise_result_t * const p_result)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	xpt2046_noise_bin_t bins[ XPT2046_NOISE_PHASE_BINS ];
+	uint64_t power[ XPT2046_NOISE_PEAK_NUM ] = { 0 };
+	uint64_t p_prev, p_cur, p_next;
+	uint64_t score, score_best, var, var_min, var_all;
+	uint32_t k, i, j, k_peak;
+	uint32_t period, period_min, period_max, step;
+	int64_t sum_x = 0;
+	int64_t sum_y = 0;
+
+	if 	(	( NULL != p_result )
+		&&	( NULL != gp_capture ))
+	{
+		// Capture still-hold samples
+		status = xpt2046_noise_capture();
+
+		if ( eXPT2046_OK == status )
+		{
+			for ( i = 0; i < XPT2046_NOISE_SAMP_NUM; i++ )
+			{
+				sum_x += gp_capture->x[i];
+				sum_y += gp_capture->y[i];
+			}
+
+			gp_capture->x_mean = (int32_t)( sum_x / (int64_t) XPT2046_NOISE_SAMP_NUM );
+			gp_capture->y_mean = (int32_t)( sum_y / (int64_t) XPT2046_NOISE_SAMP_NUM );
+
+			for ( i = 0; i < XPT2046_NOISE_PEAK_NUM; i++ )
+			{
+				p_result->peak[i].freq_hz = 0;
+				p_result->peak[i].amplitude = 0;
+			}
+
+			// Goertzel bank, keep strongest local maxima
+			// NOTE: First bin is skipped as it is dominated by drift
+			k_peak = 0;
+			p_prev = xpt2046_noise_goertzel( 1U );
+			p_cur = xpt2046_noise_goertzel( 2U );
+
+			for ( k = 2; k < ( XPT2046_NOISE_SAMP_NUM / 2U ); k++ )
+			{
+				p_next = ( k < (( XPT2046_NOISE_SAMP_NUM / 2U ) - 1U )) ? xpt2046_noise_goertzel( k + 1U ) : 0U;
+
+				if (( p_cur > p_prev ) && ( p_cur >= p_next ))
+				{
+					for ( i = 0; i < XPT2046_NOISE_PEAK_NUM; i++ )
+					{
+						if ( p_cur > power[i] )
+						{
+							for ( j = XPT2046_NOISE_PEAK_NUM - 1U; j > i; j-- )
+							{
+								power[j] = power[j-1];
+								p_result->peak[j] = p_result->peak[j-1];
+							}
+
+							power[i] = p_cur;
+							p_result->peak[i].freq_hz = ( k * 1000000UL ) / ( XPT2046_NOISE_SAMP_NUM * XPT2046_NOISE_SAMP_PERIOD_US );
+
+							// Sine of amplitude A gives power (A*N/2)^2 per channel
+							p_result->peak[i].amplitude = (uint16_t)(( 2U * xpt2046_noise_isqrt( p_cur )) / XPT2046_NOISE_SAMP_NUM );
+
+							if ( 0U == i )
+							{
+								k_peak = k;
+							}
+							break;
+						}
+					}
+				}
+
+				p_prev = p_cur;
+				p_cur = p_next;
+			}
+
+			// Unsynchronized noise
+			(void) xpt2046_noise_fold( 0xFFFFFFFFUL, bins );
+			var_all = xpt2046_noise_bin_var( &bins[0] );
+			p_result->noise_rms = (uint16_t) xpt2046_noise_isqrt( var_all );
+			p_result->noise_rms_sync = p_result->noise_rms;
+			p_result->period_us = 0;
+			p_result->phase_us = 0;
+
+			if ( k_peak > 0U )
+			{
+				// Refine period within +/- half of spectrum bin
+				period_min = ( 2U * XPT2046_NOISE_SAMP_NUM * XPT2046_NOISE_SAMP_PERIOD_US ) / ( 2U * k_peak + 1U );
+				period_max = ( 2U * XPT2046_NOISE_SAMP_NUM * XPT2046_NOISE_SAMP_PERIOD_US ) / ( 2U * k_peak - 1U );
+				step = ( period_max - period_min ) / XPT2046_NOISE_FOLD_STEPS;
+				step = ( 0U == step ) ? 1U : step;
+				score_best = 0;
+
+				for ( period = period_min; period <= period_max; period += step )
+				{
+					score = xpt2046_noise_fold( period, bins );
+
+					if ( score > score_best )
+					{
+						score_best = score;
+						p_result->period_us = period;
+					}
+				}
+
+				// Quietest phase bin
+				(void) xpt2046_noise_fold( p_result->period_us, bins );
+				var_min = UINT64_MAX;
+
+				for ( i = 0; i < XPT2046_NOISE_PHASE_BINS; i++ )
+				{
+					var = xpt2046_noise_bin_var( &bins[i] );
+
+					if (( bins[i].cnt > 1U ) && ( var < var_min ))
+					{
+						var_min = var;
+						p_result->phase_us = (( 2U * i + 1U ) * p_result->period_us ) / ( 2U * XPT2046_NOISE_PHASE_BINS );
+						p_result->noise_rms_sync = (uint16_t) xpt2046_noise_isqrt( var );
+					}
+				}
+			}
+
+			// Sync acquisition
+			p_result->sync 	= 	(	( p_result->period_us > 0U )
+								&&	( p_result->period_us <= XPT2046_NOISE_SYNC_MAX_US )
+								&&	( p_result->noise_rms_sync < p_result->noise_rms ));
+
+			gp_sync->t_anchor = gp_capture->t_start;
+
+			if ( true == p_result->sync )
+			{
+				xpt2046_noise_set_sync( p_result->period_us, p_result->phase_us );
+			}
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set acquisition sync manually
+*
+* @note		Phase is relative to start of last analysis capture, or to
+* 			XPT2046_GET_US_TICK() value of zero if analysis was never run.
+*
+* 			Period resolution of analyzer is limited by capture length,
+* 			thus sync to interference, which is not derived from same
+* 			clock, drifts over time. When exact period is known (e.g.
+* 			backlight PWM configuration) it can be set together with
+* 			analyzed phase:
+*
+* 				xpt2046_noise_set_sync( 1000, result.phase_us );
+*
+* @param[in]	period_us	- Interference period, 0 disables sync [us]
+* @param[in]	phase_us	- Sampling phase within period [us]
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_noise_set_sync(const uint32_t period_us, const uint32_t phase_us)
+{
+	if ( NULL != gp_sync )
+	{
+		gp_sync->period 	= 0;
+		gp_sync->t_ref 		= gp_sync->t_anchor;
+
+		if ( period_us > 0U )
+		{
+			gp_sync->phase 		= phase_us % period_us;
+			gp_sync->period 	= period_us;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for sampling phase
+*
+* @note		Called by touch handler right before acquisition. Blocks
+* 			for at most one interference period.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_noise_sync(void)
+{
+	const uint32_t period = gp_sync->period;
+	const uint32_t now = XPT2046_GET_US_TICK();
+	uint32_t wait;
+
+	if ( period > 0U )
+	{
+		// Keep reference close to current time
+		gp_sync->t_ref += ((( now - gp_sync->t_ref ) / period ) * period );
+
+		wait = ( gp_sync->phase + period - ( now - gp_sync->t_ref )) % period;
+
+		while (( XPT2046_GET_US_TICK() - now ) < wait )
+		{
+			// Wait...
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Capture still-hold samples at fixed rate
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046_status_t xpt2046_noise_capture(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	xpt2046_raw_t raw;
+	uint32_t i;
+
+	if ( true == gp_backend->pf_is_touched())
+	{
+		gp_capture->t_start = XPT2046_GET_US_TICK();
+
+		for ( i = 0; ( i < XPT2046_NOISE_SAMP_NUM ) && ( eXPT2046_OK == status ); i++ )
+		{
+			while (( XPT2046_GET_US_TICK() - gp_capture->t_start ) < ( i * XPT2046_NOISE_SAMP_PERIOD_US ))
+			{
+				// Wait...
+			}
+
+			gp_capture->t[i] = XPT2046_GET_US_TICK() - gp_capture->t_start;
+
+			status = gp_backend->pf_acquire( &raw );
+
+			if ( eXPT2046_OK == status )
+			{
+				gp_capture->x[i] = raw.x;
+				gp_capture->y[i] = raw.y;
+			}
+		}
+
+		// Pen must be held during whole capture
+		if ( false == gp_backend->pf_is_touched())
+		{
+			status = eXPT2046_ERROR;
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Goertzel power of spectrum bin
+*
+* @param[in]	k		- Spectrum bin
+* @return 		power	- Sum of X and Y channel power
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t xpt2046_noise_goertzel(const uint32_t k)
+{
+	// 2*cos(w) in Q14 equals cos(w) in Q15
+	const int64_t coef = xpt2046_noise_cos_q15( k );
+	int64_t sx0, sx1 = 0, sx2 = 0;
+	int64_t sy0, sy1 = 0, sy2 = 0;
+	uint64_t power;
+	uint32_t i;
+
+	for ( i = 0; i < XPT2046_NOISE_SAMP_NUM; i++ )
+	{
+		sx0 = ( (int32_t) gp_capture->x[i] - gp_capture->x_mean ) + (( coef * sx1 ) >> XPT2046_NOISE_COEF_FRAC ) - sx2;
+		sx2 = sx1;
+		sx1 = sx0;
+
+		sy0 = ( (int32_t) gp_capture->y[i] - gp_capture->y_mean ) + (( coef * sy1 ) >> XPT2046_NOISE_COEF_FRAC ) - sy2;
+		sy2 = sy1;
+		sy1 = sy0;
+	}
+
+	power 	= (uint64_t)(( sx1 * sx1 ) + ( sx2 * sx2 ) - ((( coef * sx1 ) >> XPT2046_NOISE_COEF_FRAC ) * sx2 ));
+	power 	+= (uint64_t)(( sy1 * sy1 ) + ( sy2 * sy2 ) - ((( coef * sy1 ) >> XPT2046_NOISE_COEF_FRAC ) * sy2 ));
+
+	return power;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fold captured samples over period into phase bins
+*
+* @note		X and Y deviations from mean are accumulated together.
+*
+* @param[in]	period	- Folding period [us]
+* @param[out]	p_bins	- Pointer to phase bins
+* @return 		score	- Between-bin variance (scaled), high when period
+* 						  matches interference
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t xpt2046_noise_fold(const uint32_t period, xpt2046_noise_bin_t * const p_bins)
+{
+	uint64_t score = 0;
+	uint32_t i, b;
+	int64_t dx, dy;
+
+	for ( b = 0; b < XPT2046_NOISE_PHASE_BINS; b++ )
+	{
+		p_bins[b].sum = 0;
+		p_bins[b].sum_sq = 0;
+		p_bins[b].cnt = 0;
+	}
+
+	for ( i = 0; i < XPT2046_NOISE_SAMP_NUM; i++ )
+	{
+		b = (uint32_t)(((uint64_t)( gp_capture->t[i] % period ) * XPT2046_NOISE_PHASE_BINS ) / period );
+
+		dx = (int32_t) gp_capture->x[i] - gp_capture->x_mean;
+		dy = (int32_t) gp_capture->y[i] - gp_capture->y_mean;
+
+		p_bins[b].sum += dx + dy;
+		p_bins[b].sum_sq += (uint64_t)(( dx * dx ) + ( dy * dy ));
+		p_bins[b].cnt += 2U;
+	}
+
+	for ( b = 0; b < XPT2046_NOISE_PHASE_BINS; b++ )
+	{
+		if ( p_bins[b].cnt > 0U )
+		{
+			score += (uint64_t)(( p_bins[b].sum * p_bins[b].sum ) / p_bins[b].cnt );
+		}
+	}
+
+	return score;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Variance of phase bin
+*
+* @param[in]	p_bin	- Pointer to phase bin
+* @return 		var		- Variance [LSB^2]
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t xpt2046_noise_bin_var(const xpt2046_noise_bin_t * const p_bin)
+{
+	uint64_t var = 0;
+	int64_t mean;
+
+	if ( p_bin->cnt > 0U )
+	{
+		mean = p_bin->sum / (int64_t) p_bin->cnt;
+		var = ( p_bin->sum_sq / p_bin->cnt ) - (uint64_t)( mean * mean );
+	}
+
+	return var;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Cosine of spectrum bin frequency
+*
+* @param[in]	k		- Spectrum bin (0..XPT2046_NOISE_SAMP_NUM/2)
+* @return 		cos		- cos(2*pi*k/256) in Q15
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t xpt2046_noise_cos_q15(const uint32_t k)
+{
+	int32_t val;
+
+	if ( k <= 64U )
+	{
+		val = gi16_sin_q15[ 64U - k ];
+	}
+	else
+	{
+		val = -gi16_sin_q15[ k - 64U ];
+	}
+
+	return val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Integer square root
+*
+* @param[in]	val		- Input value
+* @return 		root	- Floor of square root
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_noise_isqrt(const uint64_t val)
+{
+	uint64_t rem = val;
+	uint64_t root = 0;
+	uint64_t bit = ( 1ULL << 62 );
+
+	while ( bit > rem )
+	{
+		bit >>= 2;
+	}
+
+	while ( 0U != bit )
+	{
+		if ( rem >= ( root + bit ))
+		{
+			rem -= ( root + bit );
+			root = ( root >> 1 ) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+
+		bit >>= 2;
+	}
+
+	return (uint32_t) root;
+}
+
+#endif // 1 == XPT2046_NOISE_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_noise.h
+*@brief     Interference analyzer and acquisition phase sync for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_NOISE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Interference analyzer and acquisition phase sync.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_NOISE_H_
+#define _XPT2046_NOISE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of reported interference peaks
+ */
+#define XPT2046_NOISE_PEAK_NUM				( 3U )
+
+// Interference peak
+typedef struct
+{
+	uint32_t	freq_hz;		// Frequency [Hz]
+	uint16_t	amplitude;		// Amplitude [LSB]
+} xpt2046_noise_peak_t;
+
+// Analysis result
+typedef struct
+{
+	xpt2046_noise_peak_t	peak[ XPT2046_NOISE_PEAK_NUM ];		// Strongest first, zero if not found
+	uint32_t				period_us;		// Refined period of strongest interference [us]
+	uint32_t				phase_us;		// Quietest sampling phase within period [us]
+	uint16_t				noise_rms;		// Noise of unsynchronized sampling [LSB]
+	uint16_t				noise_rms_sync;	// Noise at quietest phase [LSB]
+	bool					sync;			// Acquisition synchronized to interference
+} xpt2046_noise_result_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_noise_init		(void);
+xpt2046_status_t	xpt2046_noise_analyze	(xpt2046_noise_result_t * const p_result);
+void				xpt2046_noise_set_sync	(const uint32_t period_us, const uint32_t phase_us);
+
+void				xpt2046_noise_sync		(void);
+
+#endif // _XPT2046_NOISE_H_
@@ -0,0 +1,591 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_par.c
+*@brief     Runtime parameter registry for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_PAR
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Runtime parameter registry.
+*
+* 	Tuning parameters are initialized from xpt2046_cfg.h and can be
+* 	changed at run-time with range validation. New value is written to
+* 	staging slot and marked pending, thus xpt2046_par_set() can be called
+* 	from any context. Pending values are applied by touch handler at
+* 	start of next cycle, so pipeline never sees parameter change in the
+* 	middle of processing.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_par.h"
+#include "xpt2046_mem.h"
+#include "xpt2046_pressure.h"
+#include "xpt2046_clk.h"
+#include "xpt2046_heatmap.h"
+#include "../../xpt2046_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameter limits
+typedef struct
+{
+	int32_t min;
+	int32_t max;
+} xpt2046_par_lim_t;
+
+// Parameter defaults
+typedef union
+{
+	struct
+	{
+		int32_t filter_win;
+		int32_t display_max_x;
+		int32_t display_max_y;
+		int32_t adc_resolution;
+		int32_t ref_mode;
+		int32_t cal_point[3][2];
+		int32_t pressure_light;
+		int32_t pressure_firm;
+		int32_t spi_clk;
+	} s;
+
+	int32_t val[ eXPT2046_PAR_NUM_OF ];
+} xpt2046_par_def_t;
+
+// Parameter registry
+typedef struct
+{
+	int32_t				val[ eXPT2046_PAR_NUM_OF ];		// Active values
+	volatile int32_t	stage[ eXPT2046_PAR_NUM_OF ];	// Staged values
+	volatile bool		pending[ eXPT2046_PAR_NUM_OF ];	// Staged value pending
+} xpt2046_par_t;
+
+XPT2046_MEM_CHECK( par, XPT2046_MEM_SIZE( sizeof( xpt2046_par_t )), XPT2046_MEM_PAR );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Limits
+static const xpt2046_par_lim_t g_par_lim[ eXPT2046_PAR_NUM_OF ] =
+{
+	[ eXPT2046_PAR_FILTER_WIN ]			= { 1, XPT2046_FILTER_WIN_SAMP },
+	[ eXPT2046_PAR_DISPLAY_MAX_X ]		= { 1, 4095 },
+	[ eXPT2046_PAR_DISPLAY_MAX_Y ]		= { 1, 4095 },
+	[ eXPT2046_PAR_ADC_RESOLUTION ]		= { XPT2046_ADC_12_BIT, XPT2046_ADC_8_BIT },
+	[ eXPT2046_PAR_REF_MODE ]			= { XPT2046_REF_MODE_DIFFERENTIAL, XPT2046_REF_MODE_SINGLE_ENDED },
+	[ eXPT2046_PAR_CAL_P1_X ]			= { 0, 4095 },
+	[ eXPT2046_PAR_CAL_P1_Y ]			= { 0, 4095 },
+	[ eXPT2046_PAR_CAL_P2_X ]			= { 0, 4095 },
+	[ eXPT2046_PAR_CAL_P2_Y ]			= { 0, 4095 },
+	[ eXPT2046_PAR_CAL_P3_X ]			= { 0, 4095 },
+	[ eXPT2046_PAR_CAL_P3_Y ]			= { 0, 4095 },
+	[ eXPT2046_PAR_PRESSURE_LIGHT ]		= { 1, UINT16_MAX },
+	[ eXPT2046_PAR_PRESSURE_FIRM ]		= { 0, UINT16_MAX - 1 },
+	[ eXPT2046_PAR_SPI_CLK ]			= { 0, XPT2046_CLK_NUM - 1 },
+};
+
+// Defaults
+static const xpt2046_par_def_t g_par_def =
+{
+	.s =
+	{
+		.filter_win		= XPT2046_FILTER_WIN_SAMP,
+		.display_max_x	= XPT2046_DISPLAY_MAX_X,
+		.display_max_y	= XPT2046_DISPLAY_MAX_Y,
+		.adc_resolution	= XPT2046_ADC_RESOLUTION,
+		.ref_mode		= XPT2046_REF_MODE,
+		.cal_point		=
+		{
+			XPT2046_POINT_1_XY,
+			XPT2046_POINT_2_XY,
+			XPT2046_POINT_3_XY,
+		},
+		.pressure_light	= XPT2046_PRESSURE_LIGHT_DEF,
+		.pressure_firm	= XPT2046_PRESSURE_FIRM_DEF,
+		.spi_clk		= XPT2046_CLK_DEF,
+	},
+};
+
+// Registry
+static xpt2046_par_t * gp_par = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void		xpt2046_par_stage				(const xpt2046_par_id_t id, const int32_t val);
+static bool		xpt2046_par_is_pressure_valid	(const int32_t light, const int32_t firm);
+static void		xpt2046_par_apply_side_effects	(const bool * const p_changed);
+static uint16_t xpt2046_par_crc16				(const uint8_t * const p_data, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize parameter registry with configured defaults
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_par_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	uint32_t i;
+
+	gp_par = xpt2046_mem_alloc( sizeof( xpt2046_par_t ));
+
+	if ( NULL != gp_par )
+	{
+		for ( i = 0; i < eXPT2046_PAR_NUM_OF; i++ )
+		{
+			gp_par->val[i] = g_par_def.val[i];
+			gp_par->stage[i] = g_par_def.val[i];
+			gp_par->pending[i] = false;
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Apply pending parameter changes
+*
+* @note		Called by touch handler at start of each cycle.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_par_apply(void)
+{
+	bool changed[ eXPT2046_PAR_NUM_OF ];
+	bool any = false;
+	uint32_t i;
+
+	for ( i = 0; i < eXPT2046_PAR_NUM_OF; i++ )
+	{
+		changed[i] = false;
+
+		if ( true == gp_par->pending[i] )
+		{
+			// Clear flag first, so that concurrent set is applied in next cycle
+			gp_par->pending[i] = false;
+			gp_par->val[i] = gp_par->stage[i];
+
+			changed[i] = true;
+			any = true;
+		}
+	}
+
+	if ( true == any )
+	{
+		xpt2046_par_apply_side_effects( changed );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get active parameter value
+*
+* @note		Fast access for pipeline, ID is not validated.
+*
+* @param[in]	id	- Parameter ID
+* @return 		val	- Active value
+*/
+////////////////////////////////////////////////////////////////////////////////
+int32_t xpt2046_par_get_value(const xpt2046_par_id_t id)
+{
+	return gp_par->val[ id ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set parameter
+*
+* @note		Can be called from any context. Value takes effect at start
+* 			of next touch handler cycle.
+*
+* 			Pressure light reference must stay above firm reference,
+* 			thus when both are changed order of calls matters. Setting
+* 			that would break the pair is rejected.
+*
+* @param[in]	id		- Parameter ID
+* @param[in]	val		- New value
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_par_set(const xpt2046_par_id_t id, const int32_t val)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	int32_t light;
+	int32_t firm;
+
+	if 	(	( id < eXPT2046_PAR_NUM_OF )
+		&&	( NULL != gp_par )
+		&&	( val >= g_par_lim[ id ].min )
+		&&	( val <= g_par_lim[ id ].max ))
+	{
+		// Pressure references are checked as pair against staged values
+		light = ( eXPT2046_PAR_PRESSURE_LIGHT == id ) ? val : gp_par->stage[ eXPT2046_PAR_PRESSURE_LIGHT ];
+		firm = ( eXPT2046_PAR_PRESSURE_FIRM == id ) ? val : gp_par->stage[ eXPT2046_PAR_PRESSURE_FIRM ];
+
+		if ( true == xpt2046_par_is_pressure_valid( light, firm ))
+		{
+			xpt2046_par_stage( id, val );
+		}
+		else
+		{
+			status = eXPT2046_ERROR;
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get parameter
+*
+* @note		Returns last set value, even if it is not yet applied.
+*
+* @param[in]	id		- Parameter ID
+* @param[out]	p_val	- Pointer to value
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_par_get(const xpt2046_par_id_t id, int32_t * const p_val)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( id < eXPT2046_PAR_NUM_OF )
+		&&	( NULL != gp_par )
+		&&	( NULL != p_val ))
+	{
+		*p_val = gp_par->stage[ id ];
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get parameter limits
+*
+* @param[in]	id		- Parameter ID
+* @param[out]	p_min	- Pointer to min. value
+* @param[out]	p_max	- Pointer to max. value
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_par_get_limits(const xpt2046_par_id_t id, int32_t * const p_min, int32_t * const p_max)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( id < eXPT2046_PAR_NUM_OF )
+		&&	( NULL != p_min )
+		&&	( NULL != p_max ))
+	{
+		*p_min = g_par_lim[ id ].min;
+		*p_max = g_par_lim[ id ].max;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set all parameters to configured defaults
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_par_set_default(void)
+{
+	uint32_t i;
+
+	if ( NULL != gp_par )
+	{
+		// Defaults are valid as a whole, but not necessarily in set order
+		for ( i = 0; i < eXPT2046_PAR_NUM_OF; i++ )
+		{
+			xpt2046_par_stage((xpt2046_par_id_t) i, g_par_def.val[i] );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Serialize parameters to blob
+*
+* @note		Size of buffer shall be at least XPT2046_PAR_BLOB_SIZE.
+*
+* @param[out]	p_buf	- Pointer to output buffer
+* @param[in]	size	- Size of output buffer
+* @param[out]	p_len	- Pointer to length of blob
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_par_serialize(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	uint32_t idx = XPT2046_PAR_HEADER_SIZE;
+	uint32_t val;
+	uint16_t crc;
+	uint32_t i;
+
+	if 	(	( NULL != p_buf )
+		&&	( NULL != p_len )
+		&&	( NULL != gp_par )
+		&&	( size >= XPT2046_PAR_BLOB_SIZE ))
+	{
+		p_buf[0] = XPT2046_PAR_MAGIC_0;
+		p_buf[1] = XPT2046_PAR_MAGIC_1;
+		p_buf[2] = XPT2046_PAR_FORMAT_VER;
+		p_buf[3] = eXPT2046_PAR_NUM_OF;
+
+		for ( i = 0; i < eXPT2046_PAR_NUM_OF; i++ )
+		{
+			val = (uint32_t) gp_par->stage[i];
+
+			p_buf[ idx++ ] = (uint8_t)( val );
+			p_buf[ idx++ ] = (uint8_t)( val >> 8U );
+			p_buf[ idx++ ] = (uint8_t)( val >> 16U );
+			p_buf[ idx++ ] = (uint8_t)( val >> 24U );
+		}
+
+		crc = xpt2046_par_crc16( p_buf, idx );
+		p_buf[ idx++ ] = (uint8_t)( crc );
+		p_buf[ idx++ ] = (uint8_t)( crc >> 8U );
+
+		*p_len = idx;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Deserialize parameters from blob
+*
+* @note		Blobs with less parameters (older firmware) are accepted,
+* 			missing parameters keep their value. Blob is rejected as a
+* 			whole if any value is out of range or pressure light
+* 			reference is not above firm reference.
+*
+* @param[in]	p_buf	- Pointer to blob
+* @param[in]	len		- Length of blob
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_par_deserialize(const uint8_t * const p_buf, const uint32_t len)
+{
+	xpt2046_status_t status = eXPT2046_ERROR;
+	int32_t val[ eXPT2046_PAR_NUM_OF ];
+	uint32_t num;
+	uint32_t idx;
+	uint32_t i;
+
+	if 	(	( NULL != p_buf )
+		&&	( NULL != gp_par )
+		&&	( len >= ( XPT2046_PAR_HEADER_SIZE + XPT2046_PAR_CRC_SIZE ))
+		&&	( XPT2046_PAR_MAGIC_0 == p_buf[0] )
+		&&	( XPT2046_PAR_MAGIC_1 == p_buf[1] )
+		&&	( XPT2046_PAR_FORMAT_VER == p_buf[2] ))
+	{
+		num = p_buf[3];
+
+		if 	(	( num <= eXPT2046_PAR_NUM_OF )
+			&&	( len == ( XPT2046_PAR_HEADER_SIZE + ( 4U * num ) + XPT2046_PAR_CRC_SIZE ))
+			&&	( xpt2046_par_crc16( p_buf, len - XPT2046_PAR_CRC_SIZE ) == (uint16_t)( p_buf[ len - 2U ] | ( p_buf[ len - 1U ] << 8U ))))
+		{
+			status = eXPT2046_OK;
+			idx = XPT2046_PAR_HEADER_SIZE;
+
+			// Validate all first
+			for ( i = 0; i < num; i++ )
+			{
+				val[i] = (int32_t)(	(uint32_t) p_buf[ idx ]
+								| 	((uint32_t) p_buf[ idx + 1U ] << 8U )
+								| 	((uint32_t) p_buf[ idx + 2U ] << 16U )
+								| 	((uint32_t) p_buf[ idx + 3U ] << 24U ));
+				idx += 4U;
+
+				if (( val[i] < g_par_lim[i].min ) || ( val[i] > g_par_lim[i].max ))
+				{
+					status = eXPT2046_ERROR;
+					break;
+				}
+			}
+
+			// Missing parameters keep their value
+			for ( i = num; i < eXPT2046_PAR_NUM_OF; i++ )
+			{
+				val[i] = gp_par->stage[i];
+			}
+
+			if ( false == xpt2046_par_is_pressure_valid( val[ eXPT2046_PAR_PRESSURE_LIGHT ], val[ eXPT2046_PAR_PRESSURE_FIRM ] ))
+			{
+				status = eXPT2046_ERROR;
+			}
+
+			// Then set, pair is already checked as a whole
+			if ( eXPT2046_OK == status )
+			{
+				for ( i = 0; i < num; i++ )
+				{
+					xpt2046_par_stage((xpt2046_par_id_t) i, val[i] );
+				}
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stage parameter value
+*
+* @note		Value shall already be validated.
+*
+* @param[in]	id		- Parameter ID
+* @param[in]	val		- New value
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_par_stage(const xpt2046_par_id_t id, const int32_t val)
+{
+	gp_par->stage[ id ] = val;
+	gp_par->pending[ id ] = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check pressure reference pair
+*
+* @param[in]	light	- Light press reference
+* @param[in]	firm	- Firm press reference
+* @return 		valid	- Light reference is above firm reference
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool xpt2046_par_is_pressure_valid(const int32_t light, const int32_t firm)
+{
+	return ( light > firm );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Propagate changed parameters to modules that cache them
+*
+* @param[in]	p_changed	- Pointer to changed flags
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_par_apply_side_effects(const bool * const p_changed)
+{
+	#if ( 1 == XPT2046_PRESSURE_EN )
+		if 	(	( true == p_changed[ eXPT2046_PAR_PRESSURE_LIGHT ] )
+			||	( true == p_changed[ eXPT2046_PAR_PRESSURE_FIRM ] ))
+		{
+			(void) xpt2046_pressure_set_cal( (uint16_t) gp_par->val[ eXPT2046_PAR_PRESSURE_LIGHT ], (uint16_t) gp_par->val[ eXPT2046_PAR_PRESSURE_FIRM ] );
+		}
+	#endif
+
+	#if ( 1 == XPT2046_CLK_TUNE_EN )
+		if ( true == p_changed[ eXPT2046_PAR_SPI_CLK ] )
+		{
+			(void) xpt2046_clk_set( (uint8_t) gp_par->val[ eXPT2046_PAR_SPI_CLK ] );
+		}
+	#endif
+
+	#if ( 1 == XPT2046_HEATMAP_EN )
+		if 	(	( true == p_changed[ eXPT2046_PAR_DISPLAY_MAX_X ] )
+			||	( true == p_changed[ eXPT2046_PAR_DISPLAY_MAX_Y ] ))
+		{
+			xpt2046_heatmap_set_display_max( (uint16_t) gp_par->val[ eXPT2046_PAR_DISPLAY_MAX_X ], (uint16_t) gp_par->val[ eXPT2046_PAR_DISPLAY_MAX_Y ] );
+		}
+	#endif
+
+	#if (( 0 == XPT2046_PRESSURE_EN ) && ( 0 == XPT2046_CLK_TUNE_EN ) && ( 0 == XPT2046_HEATMAP_EN ))
+		(void) p_changed;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC-16/CCITT
+*
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data
+* @return 		crc		- CRC value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_par_crc16(const uint8_t * const p_data, const uint32_t size)
+{
+	uint16_t crc = 0xFFFFU;
+	uint32_t i;
+	uint32_t b;
+
+	for ( i = 0; i < size; i++ )
+	{
+		crc ^= (uint16_t)( p_data[i] << 8U );
+
+		for ( b = 0; b < 8U; b++ )
+		{
+			if ( crc & 0x8000U )
+			{
+				crc = (uint16_t)(( crc << 1U ) ^ 0x1021U );
+			}
+			else
+			{
+				crc = (uint16_t)( crc << 1U );
+			}
+		}
+	}
+
+	return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,90 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_par.h
+*@brief     Runtime parameter registry for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_PAR
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Runtime parameter registry.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_PAR_H_
+#define _XPT2046_PAR_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameter IDs
+// NOTE: Append new parameters at the end to keep serialized blobs compatible!
+typedef enum
+{
+	eXPT2046_PAR_FILTER_WIN = 0,		// Filter window [samples]
+	eXPT2046_PAR_DISPLAY_MAX_X,			// Display limitation X [pixel]
+	eXPT2046_PAR_DISPLAY_MAX_Y,			// Display limitation Y [pixel]
+	eXPT2046_PAR_ADC_RESOLUTION,		// ADC resolution (XPT2046_ADC_12_BIT/XPT2046_ADC_8_BIT)
+	eXPT2046_PAR_REF_MODE,				// Reference mode (XPT2046_REF_MODE_DIFFERENTIAL/XPT2046_REF_MODE_SINGLE_ENDED)
+	eXPT2046_PAR_CAL_P1_X,				// Calibration point 1 [pixel]
+	eXPT2046_PAR_CAL_P1_Y,
+	eXPT2046_PAR_CAL_P2_X,				// Calibration point 2 [pixel]
+	eXPT2046_PAR_CAL_P2_Y,
+	eXPT2046_PAR_CAL_P3_X,				// Calibration point 3 [pixel]
+	eXPT2046_PAR_CAL_P3_Y,
+	eXPT2046_PAR_PRESSURE_LIGHT,		// Light press touch resistance
+	eXPT2046_PAR_PRESSURE_FIRM,			// Firm press touch resistance
+	eXPT2046_PAR_SPI_CLK,				// SPI clock setting of interface (0 is slowest)
+
+	eXPT2046_PAR_NUM_OF,
+} xpt2046_par_id_t;
+
+/**
+ * 	Serialized blob layout (little endian)
+ *
+ * 		[0..1]	Magic "XP"
+ * 		[2]		Format version
+ * 		[3]		Number of parameters (N)
+ * 		[4..]	N x int32 parameter values
+ * 		[..]	CRC-16/CCITT over all preceding bytes
+ */
+#define XPT2046_PAR_MAGIC_0					( 'X' )
+#define XPT2046_PAR_MAGIC_1					( 'P' )
+#define XPT2046_PAR_FORMAT_VER				( 1U )
+#define XPT2046_PAR_HEADER_SIZE				( 4U )
+#define XPT2046_PAR_CRC_SIZE				( 2U )
+
+/**
+ * 	Size of serialized blob in bytes
+ */
+#define XPT2046_PAR_BLOB_SIZE				( XPT2046_PAR_HEADER_SIZE + ( 4U * eXPT2046_PAR_NUM_OF ) + XPT2046_PAR_CRC_SIZE )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_par_init			(void);
+void				xpt2046_par_apply			(void);
+int32_t				xpt2046_par_get_value		(const xpt2046_par_id_t id);
+
+xpt2046_status_t	xpt2046_par_set				(const xpt2046_par_id_t id, const int32_t val);
+xpt2046_status_t	xpt2046_par_get				(const xpt2046_par_id_t id, int32_t * const p_val);
+xpt2046_status_t	xpt2046_par_get_limits		(const xpt2046_par_id_t id, int32_t * const p_min, int32_t * const p_max);
+void				xpt2046_par_set_default		(void);
+xpt2046_status_t	xpt2046_par_serialize		(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len);
+xpt2046_status_t	xpt2046_par_deserialize		(const uint8_t * const p_buf, const uint32_t len);
+
+#endif // _XPT2046_PAR_H_
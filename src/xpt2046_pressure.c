@@ -0,0 +1,378 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_pressure.c
+*@brief     Pressure calibration and response curve for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_PRESSURE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Conversion of raw touch resistance into normalized pressure.
+*
+* 	Raw touch resistance is inverse to pressure (light touch has high
+* 	resistance). It is first normalized between light and firm reference
+* 	press into 0-1024 range and then shaped via response curve LUT into
+* 	final 0-1023 pressure. All math is done in fixed point.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "xpt2046_pressure.h"
+#include "xpt2046_mem.h"
+#include "xpt2046_par.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_PRESSURE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Normalized input range (Q10)
+#define XPT2046_PRESSURE_NORM_SHIFT			( 10U )
+#define XPT2046_PRESSURE_NORM_MAX			( 1UL << XPT2046_PRESSURE_NORM_SHIFT )
+
+// LUT step in normalized input units (1024 / 16)
+#define XPT2046_PRESSURE_LUT_SHIFT			( 6U )
+#define XPT2046_PRESSURE_LUT_FRAC_MASK		(( 1UL << XPT2046_PRESSURE_LUT_SHIFT ) - 1UL )
+
+// Scale factor precision
+#define XPT2046_PRESSURE_SCALE_SHIFT		( 16U )
+
+// Pressure calibration
+typedef struct
+{
+	uint16_t	lut[ XPT2046_PRESSURE_LUT_SIZE ];	// Response curve
+	uint16_t	light;								// Light press resistance
+	uint16_t	firm;								// Firm press resistance
+	uint32_t	scale;								// Normalization scale factor
+	uint16_t	cap_light;							// Captured reference presses
+	uint16_t	cap_firm;
+} xpt2046_pressure_t;
+
+XPT2046_MEM_CHECK( pressure, XPT2046_MEM_SIZE( sizeof( xpt2046_pressure_t )), XPT2046_MEM_PRESSURE );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Predefined response curves
+static const uint16_t g_pressure_curves[ eXPT2046_PRESSURE_CURVE_NUM_OF ][ XPT2046_PRESSURE_LUT_SIZE ] =
+{
+	// Linear
+	{ 0, 64, 128, 192, 256, 320, 384, 448, 512, 575, 639, 703, 767, 831, 895, 959, 1023 },
+
+	// Soft (square root)
+	{ 0, 256, 362, 443, 512, 572, 626, 677, 723, 767, 809, 848, 886, 922, 957, 991, 1023 },
+
+	// Firm (square)
+	{ 0, 4, 16, 36, 64, 100, 144, 196, 256, 324, 400, 484, 575, 675, 783, 899, 1023 },
+};
+
+// Pressure calibration
+static xpt2046_pressure_t * gp_pressure = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_pressure_calc_scale(const uint16_t light, const uint16_t firm);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize pressure calibration to configured defaults
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_pressure_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_pressure = xpt2046_mem_alloc( sizeof( xpt2046_pressure_t ));
+
+	if ( NULL != gp_pressure )
+	{
+		status |= xpt2046_pressure_set_curve( XPT2046_PRESSURE_CURVE );
+		status |= xpt2046_pressure_set_cal( XPT2046_PRESSURE_LIGHT_DEF, XPT2046_PRESSURE_FIRM_DEF );
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert raw touch resistance to normalized pressure
+*
+* @param[in]	resistance	- Raw touch resistance
+* @return 		pressure	- Pressure in range 0-1023
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint16_t xpt2046_pressure_calc(const uint16_t resistance)
+{
+	uint16_t pressure;
+	uint32_t norm;
+	uint32_t idx;
+	uint32_t frac;
+	int32_t delta;
+
+	// Normalize between light and firm reference
+	if ( resistance >= gp_pressure->light )
+	{
+		norm = 0;
+	}
+	else if ( resistance <= gp_pressure->firm )
+	{
+		norm = XPT2046_PRESSURE_NORM_MAX;
+	}
+	else
+	{
+		norm = ((uint32_t)( gp_pressure->light - resistance ) * gp_pressure->scale ) >> XPT2046_PRESSURE_SCALE_SHIFT;
+
+		if ( norm > XPT2046_PRESSURE_NORM_MAX )
+		{
+			norm = XPT2046_PRESSURE_NORM_MAX;
+		}
+	}
+
+	// Interpolate response curve
+	idx = norm >> XPT2046_PRESSURE_LUT_SHIFT;
+	frac = norm & XPT2046_PRESSURE_LUT_FRAC_MASK;
+
+	if ( idx >= ( XPT2046_PRESSURE_LUT_SIZE - 1U ))
+	{
+		pressure = gp_pressure->lut[ XPT2046_PRESSURE_LUT_SIZE - 1U ];
+	}
+	else
+	{
+		delta = (int32_t) gp_pressure->lut[ idx + 1U ] - (int32_t) gp_pressure->lut[ idx ];
+		pressure = (uint16_t)((int32_t) gp_pressure->lut[ idx ] + (( delta * (int32_t) frac ) >> XPT2046_PRESSURE_LUT_SHIFT ));
+	}
+
+	return pressure;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set pressure calibration references
+*
+* @note		Light press must have higher resistance than firm press.
+*
+* @param[in]	light	- Raw touch resistance of light reference press
+* @param[in]	firm	- Raw touch resistance of firm reference press
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_pressure_set_cal(const uint16_t light, const uint16_t firm)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( NULL != gp_pressure )
+		&&	( light > firm ))
+	{
+		gp_pressure->light = light;
+		gp_pressure->firm = firm;
+		gp_pressure->scale = xpt2046_pressure_calc_scale( light, firm );
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get pressure calibration references
+*
+* @param[out]	p_light	- Pointer to light press resistance
+* @param[out]	p_firm	- Pointer to firm press resistance
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_pressure_get_cal(uint16_t * const p_light, uint16_t * const p_firm)
+{
+	if 	(	( NULL != p_light )
+		&&	( NULL != gp_pressure ))
+	{
+		*p_light = gp_pressure->light;
+	}
+
+	if 	(	( NULL != p_firm )
+		&&	( NULL != gp_pressure ))
+	{
+		*p_firm = gp_pressure->firm;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Select predefined pressure response curve
+*
+* @param[in]	curve	- Response curve
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_pressure_set_curve(const xpt2046_pressure_curve_t curve)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( NULL != gp_pressure )
+		&&	( curve < eXPT2046_PRESSURE_CURVE_NUM_OF ))
+	{
+		memcpy( &gp_pressure->lut, &g_pressure_curves[ curve ], sizeof( gp_pressure->lut ));
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set custom pressure response curve
+*
+* @note		LUT must have XPT2046_PRESSURE_LUT_SIZE monotonic points
+* 			in range 0-1023.
+*
+* @param[in]	p_lut	- Pointer to response curve LUT
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_pressure_set_lut(const uint16_t * const p_lut)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	uint32_t i;
+
+	if 	(	( NULL != p_lut )
+		&&	( NULL != gp_pressure ))
+	{
+		for ( i = 0; i < XPT2046_PRESSURE_LUT_SIZE; i++ )
+		{
+			if	(	( p_lut[i] > XPT2046_PRESSURE_MAX )
+				||	(( i > 0 ) && ( p_lut[i] < p_lut[ i - 1U ] )))
+			{
+				status = eXPT2046_ERROR;
+				break;
+			}
+		}
+
+		if ( eXPT2046_OK == status )
+		{
+			memcpy( &gp_pressure->lut, p_lut, sizeof( gp_pressure->lut ));
+		}
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Capture pressure calibration reference press
+*
+* @note		User shall press the panel with light or firm reference press
+* 			and call that function while touch is still pressed. Once
+* 			both references are captured calibration takes effect.
+*
+* @param[in]	ref		- Reference press type
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_pressure_capture(const xpt2046_pressure_ref_t ref)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	uint16_t resistance;
+
+	status = xpt2046_get_touch_resistance( &resistance );
+
+	if ( eXPT2046_OK == status )
+	{
+		if ( eXPT2046_PRESSURE_REF_LIGHT == ref )
+		{
+			gp_pressure->cap_light = resistance;
+		}
+		else
+		{
+			gp_pressure->cap_firm = resistance;
+		}
+
+		// Both captured -> store to parameters, applied on next cycle
+		if (( 0U != gp_pressure->cap_light ) && ( 0U != gp_pressure->cap_firm ))
+		{
+			if ( gp_pressure->cap_light > gp_pressure->cap_firm )
+			{
+				// Pair must stay valid after each set, one of orders always does
+				if ( eXPT2046_OK == xpt2046_par_set( eXPT2046_PAR_PRESSURE_LIGHT, gp_pressure->cap_light ))
+				{
+					status |= xpt2046_par_set( eXPT2046_PAR_PRESSURE_FIRM, gp_pressure->cap_firm );
+				}
+				else
+				{
+					status |= xpt2046_par_set( eXPT2046_PAR_PRESSURE_FIRM, gp_pressure->cap_firm );
+					status |= xpt2046_par_set( eXPT2046_PAR_PRESSURE_LIGHT, gp_pressure->cap_light );
+				}
+			}
+			else
+			{
+				status = eXPT2046_ERROR;
+			}
+
+			gp_pressure->cap_light = 0U;
+			gp_pressure->cap_firm = 0U;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate normalization scale factor
+*
+* @note		Division is done only once here, so that run-time conversion
+* 			requires only multiplication and shift.
+*
+* @param[in]	light	- Light press resistance
+* @param[in]	firm	- Firm press resistance
+* @return 		scale	- Scale factor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_pressure_calc_scale(const uint16_t light, const uint16_t firm)
+{
+	return (uint32_t)(( XPT2046_PRESSURE_NORM_MAX << XPT2046_PRESSURE_SCALE_SHIFT ) / (uint32_t)( light - firm ));
+}
+
+#endif // 1 == XPT2046_PRESSURE_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_pressure.h
+*@brief     Pressure calibration and response curve for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_PRESSURE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Conversion of raw touch resistance into normalized pressure.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_PRESSURE_H_
+#define _XPT2046_PRESSURE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Maximum normalized pressure
+ */
+#define XPT2046_PRESSURE_MAX				( 1023U )
+
+/**
+ * 	Number of response curve LUT points
+ *
+ * @note	LUT points are equidistant over normalized input range 0-1024.
+ */
+#define XPT2046_PRESSURE_LUT_SIZE			( 17U )
+
+// Predefined response curves
+typedef enum
+{
+	eXPT2046_PRESSURE_CURVE_LINEAR = 0,		// Output follows calibrated input
+	eXPT2046_PRESSURE_CURVE_SOFT,			// More sensitive to light touches
+	eXPT2046_PRESSURE_CURVE_FIRM,			// More sensitive to firm touches
+
+	eXPT2046_PRESSURE_CURVE_NUM_OF,
+} xpt2046_pressure_curve_t;
+
+// Pressure calibration reference press
+typedef enum
+{
+	eXPT2046_PRESSURE_REF_LIGHT = 0,
+	eXPT2046_PRESSURE_REF_FIRM,
+} xpt2046_pressure_ref_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_pressure_init			(void);
+uint16_t			xpt2046_pressure_calc			(const uint16_t resistance);
+xpt2046_status_t	xpt2046_pressure_set_cal		(const uint16_t light, const uint16_t firm);
+void				xpt2046_pressure_get_cal		(uint16_t * const p_light, uint16_t * const p_firm);
+xpt2046_status_t	xpt2046_pressure_set_curve		(const xpt2046_pressure_curve_t curve);
+xpt2046_status_t	xpt2046_pressure_set_lut		(const uint16_t * const p_lut);
+xpt2046_status_t	xpt2046_pressure_capture		(const xpt2046_pressure_ref_t ref);
+
+#endif // _XPT2046_PRESSURE_H_
@@ -0,0 +1,384 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_roi.c
+*@brief     Raw-space region of interest rejection for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_ROI
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Raw-space region of interest rejection.
+*
+* 	Application registers active regions (widgets) in display space.
+* 	Regions are expanded by XPT2046_ROI_MARGIN and mapped through inverse
+* 	calibration into raw ADC bounding boxes, thus each sample is checked
+* 	with integer compares only, before filter and calibration math.
+*
+* 	Bounding boxes are recalculated in touch handler context when
+* 	regions or calibration factors change. Without any region set all
+* 	samples are accepted.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_roi.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_ROI_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Raw ADC full scale
+#define XPT2046_ROI_RAW_MAX					( 4095 )
+
+// Raw-space bounding box
+typedef struct
+{
+	uint16_t	x_min;
+	uint16_t	x_max;
+	uint16_t	y_min;
+	uint16_t	y_max;
+} xpt2046_roi_box_t;
+
+// Regions
+typedef struct
+{
+	xpt2046_roi_t		roi[ XPT2046_ROI_MAX ];		// Display space
+	xpt2046_roi_box_t	box[ XPT2046_ROI_MAX ];		// Raw space, packed
+	uint32_t			used;						// Bit mask of set regions
+	uint32_t			num_of_box;					// Number of valid boxes
+	bool				all;						// Accept all samples
+	volatile bool		dirty;						// Boxes to be recalculated
+} xpt2046_roi_data_t;
+
+XPT2046_MEM_CHECK( roi, XPT2046_MEM_SIZE( sizeof( xpt2046_roi_data_t )), XPT2046_MEM_ROI );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Regions
+static xpt2046_roi_data_t * gp_roi = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void 	xpt2046_roi_recalc		(const int32_t * const p_factors);
+static bool 	xpt2046_roi_map			(const int32_t * const p_factors, const int32_t Dx, const int32_t Dy, int32_t * const p_Tx, int32_t * const p_Ty);
+static uint16_t	xpt2046_roi_clamp		(const int32_t val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize regions of interest
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_roi_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_roi = xpt2046_mem_alloc( sizeof( xpt2046_roi_data_t ));
+
+	if ( NULL == gp_roi )
+	{
+		status = eXPT2046_ERROR;
+	}
+	else
+	{
+		// No regions, accept all samples
+		gp_roi->all = true;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set region of interest
+*
+* @note		Takes effect at next touch handler cycle.
+*
+* @param[in]	idx		- Region index (0..XPT2046_ROI_MAX-1)
+* @param[in]	p_roi	- Pointer to region in display space
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_roi_set(const uint8_t idx, const xpt2046_roi_t * const p_roi)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( idx < XPT2046_ROI_MAX )
+		&&	( NULL != gp_roi )
+		&&	( NULL != p_roi )
+		&&	( p_roi->w > 0U )
+		&&	( p_roi->h > 0U ))
+	{
+		gp_roi->roi[ idx ] = *p_roi;
+		gp_roi->used |= ( 1UL << idx );
+		gp_roi->dirty = true;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Remove region of interest
+*
+* @param[in]	idx		- Region index
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_roi_remove(const uint8_t idx)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( idx < XPT2046_ROI_MAX )
+		&&	( NULL != gp_roi ))
+	{
+		gp_roi->used &= ~( 1UL << idx );
+		gp_roi->dirty = true;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Remove all regions of interest
+*
+* @note		All samples are accepted afterwards.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_roi_clear(void)
+{
+	if ( NULL != gp_roi )
+	{
+		gp_roi->used = 0;
+		gp_roi->dirty = true;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Request recalculation of raw-space boxes
+*
+* @note		Called when calibration factors change.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_roi_invalidate(void)
+{
+	if ( NULL != gp_roi )
+	{
+		gp_roi->dirty = true;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if raw sample can hit any region
+*
+* @note		Called by touch handler for calibrated touch only.
+*
+* @param[in]	X			- Raw X sample
+* @param[in]	Y			- Raw Y sample
+* @param[in]	p_factors	- Pointer to active calibration factors
+* @return 		hit			- True if sample is inside any region
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool xpt2046_roi_check(const uint16_t X, const uint16_t Y, const int32_t * const p_factors)
+{
+	bool hit;
+	uint32_t i;
+
+	if ( true == gp_roi->dirty )
+	{
+		gp_roi->dirty = false;
+		xpt2046_roi_recalc( p_factors );
+	}
+
+	hit = gp_roi->all;
+
+	for ( i = 0; ( i < gp_roi->num_of_box ) && ( false == hit ); i++ )
+	{
+		if 	(	( X >= gp_roi->box[i].x_min ) && ( X <= gp_roi->box[i].x_max )
+			&&	( Y >= gp_roi->box[i].y_min ) && ( Y <= gp_roi->box[i].y_max ))
+		{
+			hit = true;
+		}
+	}
+
+	return hit;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Recalculate raw-space bounding boxes
+*
+* @note		Corners of expanded region are mapped through inverse
+* 			calibration. As calibration is affine (rotation included),
+* 			bounding box of mapped corners covers whole region.
+*
+* @param[in]	p_factors	- Pointer to calibration factors
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_roi_recalc(const int32_t * const p_factors)
+{
+	const uint32_t used = gp_roi->used;
+	int32_t Dx[4];
+	int32_t Dy[4];
+	int32_t Tx, Ty;
+	int32_t x_min, x_max, y_min, y_max;
+	uint32_t i, c;
+	bool valid = true;
+
+	gp_roi->num_of_box = 0;
+
+	for ( i = 0; ( i < XPT2046_ROI_MAX ) && ( true == valid ); i++ )
+	{
+		if ( 0U != ( used & ( 1UL << i )))
+		{
+			// Expanded corners
+			Dx[0] = (int32_t) gp_roi->roi[i].x - XPT2046_ROI_MARGIN;
+			Dy[0] = (int32_t) gp_roi->roi[i].y - XPT2046_ROI_MARGIN;
+			Dx[1] = (int32_t) gp_roi->roi[i].x + gp_roi->roi[i].w + XPT2046_ROI_MARGIN;
+			Dy[1] = Dy[0];
+			Dx[2] = Dx[0];
+			Dy[2] = (int32_t) gp_roi->roi[i].y + gp_roi->roi[i].h + XPT2046_ROI_MARGIN;
+			Dx[3] = Dx[1];
+			Dy[3] = Dy[2];
+
+			x_min = INT32_MAX;
+			y_min = INT32_MAX;
+			x_max = INT32_MIN;
+			y_max = INT32_MIN;
+
+			for ( c = 0; ( c < 4U ) && ( true == valid ); c++ )
+			{
+				valid = xpt2046_roi_map( p_factors, Dx[c], Dy[c], &Tx, &Ty );
+
+				if ( true == valid )
+				{
+					x_min = ( Tx < x_min ) ? Tx : x_min;
+					x_max = ( Tx > x_max ) ? Tx : x_max;
+					y_min = ( Ty < y_min ) ? Ty : y_min;
+					y_max = ( Ty > y_max ) ? Ty : y_max;
+				}
+			}
+
+			// Round outwards
+			if ( true == valid )
+			{
+				gp_roi->box[ gp_roi->num_of_box ].x_min = xpt2046_roi_clamp( x_min - 1 );
+				gp_roi->box[ gp_roi->num_of_box ].x_max = xpt2046_roi_clamp( x_max + 1 );
+				gp_roi->box[ gp_roi->num_of_box ].y_min = xpt2046_roi_clamp( y_min - 1 );
+				gp_roi->box[ gp_roi->num_of_box ].y_max = xpt2046_roi_clamp( y_max + 1 );
+				gp_roi->num_of_box++;
+			}
+		}
+	}
+
+	// No regions or calibration can not be inverted
+	gp_roi->all = (( 0U == used ) || ( false == valid ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Map display point to raw space (inverse calibration)
+*
+* @note		Calibration:	D = ( A * T + b ) / f0
+* 			Inverse:		T = A^-1 * ( f0 * D - b )
+*
+* @param[in]	p_factors	- Pointer to calibration factors
+* @param[in]	Dx			- Display X
+* @param[in]	Dy			- Display Y
+* @param[out]	p_Tx		- Pointer to raw X
+* @param[out]	p_Ty		- Pointer to raw Y
+* @return 		valid		- False if calibration is singular
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool xpt2046_roi_map(const int32_t * const p_factors, const int32_t Dx, const int32_t Dy, int32_t * const p_Tx, int32_t * const p_Ty)
+{
+	const int64_t det = ((int64_t) p_factors[1] * p_factors[5] ) - ((int64_t) p_factors[2] * p_factors[4] );
+	int64_t u, v;
+	bool valid = false;
+
+	if ( 0 != det )
+	{
+		u = ((int64_t) p_factors[0] * Dx ) - p_factors[3];
+		v = ((int64_t) p_factors[0] * Dy ) - p_factors[6];
+
+		*p_Tx = (int32_t)((( p_factors[5] * u ) - ( p_factors[2] * v )) / det );
+		*p_Ty = (int32_t)((( p_factors[1] * v ) - ( p_factors[4] * u )) / det );
+
+		valid = true;
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clamp to raw ADC range
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_roi_clamp(const int32_t val)
+{
+	uint16_t res;
+
+	if ( val < 0 )
+	{
+		res = 0;
+	}
+	else if ( val > XPT2046_ROI_RAW_MAX )
+	{
+		res = XPT2046_ROI_RAW_MAX;
+	}
+	else
+	{
+		res = (uint16_t) val;
+	}
+
+	return res;
+}
+
+#endif // 1 == XPT2046_ROI_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,55 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_roi.h
+*@brief     Raw-space region of interest rejection for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_ROI
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Raw-space region of interest rejection.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_ROI_H_
+#define _XPT2046_ROI_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Region of interest in display space
+typedef struct
+{
+	uint16_t	x;		// Left [pixel]
+	uint16_t	y;		// Top [pixel]
+	uint16_t	w;		// Width [pixel]
+	uint16_t	h;		// Height [pixel]
+} xpt2046_roi_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_roi_init		(void);
+xpt2046_status_t	xpt2046_roi_set			(const uint8_t idx, const xpt2046_roi_t * const p_roi);
+xpt2046_status_t	xpt2046_roi_remove		(const uint8_t idx);
+void				xpt2046_roi_clear		(void);
+
+void				xpt2046_roi_invalidate	(void);
+bool				xpt2046_roi_check		(const uint16_t X, const uint16_t Y, const int32_t * const p_factors);
+
+#endif // _XPT2046_ROI_H_
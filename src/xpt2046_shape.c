@@ -0,0 +1,816 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_shape.c
+*@brief     Stroke shape recognizer for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_SHAPE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Stroke shape recognizer.
+*
+* 	Point cloud ($P) recognizer in fixed point for symbol input (check
+* 	mark, X, circle, digits...). Gesture consists of one or more strokes,
+* 	it ends when pen stays up for XPT2046_SHAPE_GAP_MS. Stroke order and
+* 	direction do not matter.
+*
+* 	Cost is spread over touch handler calls:
+*
+* 		- while drawing, points are taken at fixed distance into buffer.
+* 		  When buffer is full every other point is dropped and distance
+* 		  doubles, thus buffer holds equidistant path of any length.
+* 		- at gesture end, buffer is resampled to XPT2046_SHAPE_POINTS
+* 		  points and normalized (one handler call).
+* 		- greedy cloud match against templates, XPT2046_SHAPE_MATCH_STEPS
+* 		  start points per handler call.
+*
+* 	Result is thus ready XPT2046_SHAPE_GAP_MS plus
+* 	1 + ceil( templates * starts / XPT2046_SHAPE_MATCH_STEPS ) handler
+* 	periods after last pen-up.
+*
+* 	Templates are stored in flash, generated by
+* 	tools/shape/xpt2046_shape_gen.py as xpt2046_shape_tmpl.h.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_shape.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_SHAPE_EN )
+
+// Templates (generated by tools/shape/xpt2046_shape_gen.py)
+#include "../../xpt2046_shape_tmpl.h"
+
+#if ( XPT2046_SHAPE_TMPL_POINTS != XPT2046_SHAPE_POINTS )
+	#error "Shape templates generated for different number of points!"
+#endif
+
+#if ( XPT2046_SHAPE_TMPL_NUM >= XPT2046_SHAPE_NONE )
+	#error "Too many shape templates!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Start point step of greedy match, floor( sqrt( points ))
+#define XPT2046_SHAPE_START_STEP			( 5U )
+
+// Sum of match weights ( 1 + 2 + ... + points )
+#define XPT2046_SHAPE_WEIGHT_SUM			(( XPT2046_SHAPE_POINTS * ( XPT2046_SHAPE_POINTS + 1U )) / 2U )
+
+// Average point distance at which score reaches zero
+#define XPT2046_SHAPE_DIST_ZERO				( 64U )
+
+// Resampling resolution (Q4 pixel)
+#define XPT2046_SHAPE_Q						( 4U )
+
+// Matched point set is bit mask
+#if ( XPT2046_SHAPE_POINTS > 32U )
+	#error "Max. 32 points supported!"
+#endif
+
+// Buffered stroke point
+typedef struct
+{
+	uint16_t	x;
+	uint16_t	y;
+	uint8_t		stroke;		// Stroke index
+} xpt2046_shape_samp_t;
+
+// Gesture collection state
+typedef enum
+{
+	eXPT2046_SHAPE_IDLE = 0,	// No gesture
+	eXPT2046_SHAPE_STROKE,		// Pen down, collecting points
+	eXPT2046_SHAPE_GAP,			// Pen up, waiting for next stroke or gesture end
+} xpt2046_shape_state_t;
+
+// Recognizer
+typedef struct
+{
+	xpt2046_shape_samp_t	buf[ XPT2046_SHAPE_BUF_SIZE ];
+	int8_t					cloud[ XPT2046_SHAPE_POINTS ][2];	// Normalized gesture
+	uint32_t				up_tick;		// Time of last pen-up
+	uint32_t				dist_best;		// Best distance over templates
+	uint32_t				dist_tmpl;		// Best distance of current template
+	uint16_t				num;			// Buffered points
+	uint16_t				step;			// Sampling distance [pixel]
+	uint16_t				x_last;			// Last pressed position
+	uint16_t				y_last;
+	xpt2046_shape_state_t	state;
+	uint8_t					strokes;
+	uint8_t					tmpl;			// Template being matched
+	uint8_t					start;			// Start point being matched
+	uint8_t					best;			// Best template
+	uint8_t					cloud_strokes;	// Strokes of matched gesture
+	bool					match;			// Matching in progress
+	bool					active;
+	bool					result_new;
+	xpt2046_shape_result_t	result;
+} xpt2046_shape_t;
+
+XPT2046_MEM_CHECK( shape, XPT2046_MEM_SIZE( sizeof( xpt2046_shape_t )), XPT2046_MEM_SHAPE );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Recognizer
+static xpt2046_shape_t * gp_shape = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void		xpt2046_shape_collect	(const uint16_t x, const uint16_t y, const bool pressed);
+static void		xpt2046_shape_put		(const uint16_t x, const uint16_t y);
+static void		xpt2046_shape_decimate	(void);
+static bool		xpt2046_shape_prepare	(void);
+static uint32_t	xpt2046_shape_resample	(uint16_t (* const p_pts)[2]);
+static void		xpt2046_shape_normalize	(const uint16_t (* const p_pts)[2]);
+static void		xpt2046_shape_match		(void);
+static uint32_t	xpt2046_shape_cloud_dist(const int8_t (* const p_a)[2], const int8_t (* const p_b)[2], const uint32_t start);
+static uint32_t	xpt2046_shape_dist		(const int32_t dx, const int32_t dy);
+static uint32_t	xpt2046_shape_isqrt		(const uint32_t val);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize shape recognizer
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_shape_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_shape = xpt2046_mem_alloc( sizeof( xpt2046_shape_t ));
+
+	if ( NULL == gp_shape )
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start shape recognition
+*
+* @note		Shall be called from same context as touch handler.
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_shape_start(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if ( NULL != gp_shape )
+	{
+		gp_shape->state 		= eXPT2046_SHAPE_IDLE;
+		gp_shape->match 		= false;
+		gp_shape->result_new 	= false;
+		gp_shape->active 		= true;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stop shape recognition
+*
+* @note		Gesture in progress is dropped.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_shape_stop(void)
+{
+	if ( NULL != gp_shape )
+	{
+		gp_shape->active = false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Add calibrated touch sample
+*
+* @note		Called by touch handler on each calibrated sample. Collects
+* 			gesture and advances matching of finished gesture.
+*
+* @param[in]	x		- Display x coordinate
+* @param[in]	y		- Display y coordinate
+* @param[in]	pressed	- Pressed state
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_shape_add(const uint16_t x, const uint16_t y, const bool pressed)
+{
+	if ( true == gp_shape->active )
+	{
+		// Match previous gesture while next one is drawn
+		if ( true == gp_shape->match )
+		{
+			xpt2046_shape_match();
+		}
+
+		xpt2046_shape_collect( x, y, pressed );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get recognition result
+*
+* @note		Each result is returned once.
+*
+* @param[out]	p_result	- Pointer to result
+* @return 		status		- eXPT2046_OK if new result was taken, eXPT2046_ERROR otherwise
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_shape_get(xpt2046_shape_result_t * const p_result)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	if 	(	( NULL != p_result )
+		&&	( NULL != gp_shape )
+		&&	( true == gp_shape->result_new ))
+	{
+		*p_result = gp_shape->result;
+		gp_shape->result_new = false;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get template name
+*
+* @param[in]	id		- Template index
+* @return 		p_name	- Name of template, NULL if index is invalid
+*/
+////////////////////////////////////////////////////////////////////////////////
+const char * xpt2046_shape_get_name(const uint8_t id)
+{
+	const char * p_name = NULL;
+
+	if ( id < XPT2046_SHAPE_TMPL_NUM )
+	{
+		p_name = gc_xpt2046_shape_name[ id ];
+	}
+
+	return p_name;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Collect gesture points
+*
+* @param[in]	x		- Display x coordinate
+* @param[in]	y		- Display y coordinate
+* @param[in]	pressed	- Pressed state
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_shape_collect(const uint16_t x, const uint16_t y, const bool pressed)
+{
+	const xpt2046_shape_samp_t * p_last;
+	int32_t dx;
+	int32_t dy;
+
+	switch( gp_shape->state )
+	{
+		case eXPT2046_SHAPE_IDLE:
+		case eXPT2046_SHAPE_GAP:
+			if ( true == pressed )
+			{
+				// New gesture
+				if ( eXPT2046_SHAPE_IDLE == gp_shape->state )
+				{
+					gp_shape->num 		= 0;
+					gp_shape->strokes 	= 0;
+					gp_shape->step 		= XPT2046_SHAPE_STEP_PX;
+				}
+
+				// New stroke
+				if ( gp_shape->strokes < UINT8_MAX )
+				{
+					gp_shape->strokes++;
+				}
+
+				xpt2046_shape_put( x, y );
+				gp_shape->state = eXPT2046_SHAPE_STROKE;
+			}
+			else if 	(	( eXPT2046_SHAPE_GAP == gp_shape->state )
+						&&	(( XPT2046_GET_SYSTICK() - gp_shape->up_tick ) >= XPT2046_SHAPE_GAP_MS ))
+			{
+				// Gesture finished
+				gp_shape->match = xpt2046_shape_prepare();
+				gp_shape->state = eXPT2046_SHAPE_IDLE;
+			}
+			else
+			{
+				// No actions...
+			}
+			break;
+
+		case eXPT2046_SHAPE_STROKE:
+			p_last = &gp_shape->buf[ gp_shape->num - 1U ];
+
+			if ( true == pressed )
+			{
+				dx = (int32_t) x - (int32_t) p_last->x;
+				dy = (int32_t) y - (int32_t) p_last->y;
+
+				if (( dx * dx + dy * dy ) >= ((int32_t) gp_shape->step * (int32_t) gp_shape->step ))
+				{
+					xpt2046_shape_put( x, y );
+				}
+
+				gp_shape->x_last = x;
+				gp_shape->y_last = y;
+			}
+			else
+			{
+				// End stroke at last pressed position
+				if 	(	( gp_shape->x_last != p_last->x )
+					||	( gp_shape->y_last != p_last->y ))
+				{
+					xpt2046_shape_put( gp_shape->x_last, gp_shape->y_last );
+				}
+
+				gp_shape->up_tick = XPT2046_GET_SYSTICK();
+				gp_shape->state = eXPT2046_SHAPE_GAP;
+			}
+			break;
+
+		default:
+			gp_shape->state = eXPT2046_SHAPE_IDLE;
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Put point of current stroke into buffer
+*
+* @param[in]	x		- Display x coordinate
+* @param[in]	y		- Display y coordinate
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_shape_put(const uint16_t x, const uint16_t y)
+{
+	if ( gp_shape->num >= XPT2046_SHAPE_BUF_SIZE )
+	{
+		xpt2046_shape_decimate();
+	}
+
+	gp_shape->buf[ gp_shape->num ].x 		= x;
+	gp_shape->buf[ gp_shape->num ].y 		= y;
+	gp_shape->buf[ gp_shape->num ].stroke 	= gp_shape->strokes;
+	gp_shape->num++;
+
+	gp_shape->x_last = x;
+	gp_shape->y_last = y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Drop every other point and double sampling distance
+*
+* @note		First point of each stroke is kept.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_shape_decimate(void)
+{
+	uint32_t i;
+	uint32_t n = 0;
+	uint32_t k = 0;
+
+	for ( i = 0; i < gp_shape->num; i++ )
+	{
+		// Index within stroke
+		if (( 0U == i ) || ( gp_shape->buf[i].stroke != gp_shape->buf[ i - 1U ].stroke ))
+		{
+			k = 0;
+		}
+
+		if ( 0U == ( k & 1U ))
+		{
+			gp_shape->buf[n] = gp_shape->buf[i];
+			n++;
+		}
+
+		k++;
+	}
+
+	gp_shape->num = (uint16_t) n;
+
+	if ( gp_shape->step < ( UINT16_MAX / 2U ))
+	{
+		gp_shape->step = (uint16_t)( 2U * gp_shape->step );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Prepare finished gesture for matching
+*
+* @note		Taps and gestures smaller than XPT2046_SHAPE_MIN_SIZE_PX
+* 			are ignored.
+*
+* @return 		match	- True if gesture shall be matched
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool xpt2046_shape_prepare(void)
+{
+	uint16_t pts[ XPT2046_SHAPE_POINTS ][2];
+	bool match = false;
+
+	if ( XPT2046_SHAPE_POINTS == xpt2046_shape_resample( pts ))
+	{
+		xpt2046_shape_normalize((const uint16_t (*)[2]) pts );
+
+		gp_shape->cloud_strokes = gp_shape->strokes;
+		gp_shape->tmpl 			= 0;
+		gp_shape->start 		= 0;
+		gp_shape->best 			= XPT2046_SHAPE_NONE;
+		gp_shape->dist_best 	= UINT32_MAX;
+		gp_shape->dist_tmpl 	= UINT32_MAX;
+
+		match = true;
+	}
+
+	return match;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Resample buffered gesture to equidistant points
+*
+* @note		Distance is measured along strokes only, jumps between
+* 			strokes do not count.
+*
+* @param[out]	p_pts	- Resampled points (Q4 pixel)
+* @return 		num		- Number of points, 0 if gesture is too small
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_shape_resample(uint16_t (* const p_pts)[2])
+{
+	const xpt2046_shape_samp_t * const p_buf = gp_shape->buf;
+	uint32_t i;
+	uint32_t num = 0;
+	uint32_t len = 0;
+	uint32_t interval;
+	uint32_t acc = 0;
+	uint32_t d;
+	int32_t px;
+	int32_t py;
+	int32_t bx;
+	int32_t by;
+	uint16_t min_x = UINT16_MAX;
+	uint16_t min_y = UINT16_MAX;
+	uint16_t max_x = 0;
+	uint16_t max_y = 0;
+
+	// Path length and size
+	for ( i = 0; i < gp_shape->num; i++ )
+	{
+		min_x = ( p_buf[i].x < min_x ) ? p_buf[i].x : min_x;
+		min_y = ( p_buf[i].y < min_y ) ? p_buf[i].y : min_y;
+		max_x = ( p_buf[i].x > max_x ) ? p_buf[i].x : max_x;
+		max_y = ( p_buf[i].y > max_y ) ? p_buf[i].y : max_y;
+
+		if (( i > 0U ) && ( p_buf[i].stroke == p_buf[ i - 1U ].stroke ))
+		{
+			len += xpt2046_shape_dist(((int32_t) p_buf[i].x - p_buf[ i - 1U ].x ) * ( 1 << XPT2046_SHAPE_Q ), ((int32_t) p_buf[i].y - p_buf[ i - 1U ].y ) * ( 1 << XPT2046_SHAPE_Q ));
+		}
+	}
+
+	if 	(	( gp_shape->num >= 2U )
+		&&	((( max_x - min_x ) >= XPT2046_SHAPE_MIN_SIZE_PX ) || (( max_y - min_y ) >= XPT2046_SHAPE_MIN_SIZE_PX ))
+		&&	( len >= ( XPT2046_SHAPE_POINTS - 1U )))
+	{
+		interval = len / ( XPT2046_SHAPE_POINTS - 1U );
+
+		px = (int32_t) p_buf[0].x << XPT2046_SHAPE_Q;
+		py = (int32_t) p_buf[0].y << XPT2046_SHAPE_Q;
+
+		p_pts[0][0] = (uint16_t) px;
+		p_pts[0][1] = (uint16_t) py;
+		num = 1;
+
+		i = 1;
+
+		while 	(	( i < gp_shape->num )
+				&&	( num < XPT2046_SHAPE_POINTS ))
+		{
+			bx = (int32_t) p_buf[i].x << XPT2046_SHAPE_Q;
+			by = (int32_t) p_buf[i].y << XPT2046_SHAPE_Q;
+
+			if ( p_buf[i].stroke != p_buf[ i - 1U ].stroke )
+			{
+				// Next stroke starts at its first point
+				px = bx;
+				py = by;
+				i++;
+			}
+			else
+			{
+				d = xpt2046_shape_dist( bx - px, by - py );
+
+				if 	(	( d > 0U )
+					&&	(( acc + d ) >= interval ))
+				{
+					// Point on segment at remaining interval, segment is then re-examined from it
+					px += (( bx - px ) * (int32_t)( interval - acc )) / (int32_t) d;
+					py += (( by - py ) * (int32_t)( interval - acc )) / (int32_t) d;
+
+					p_pts[ num ][0] = (uint16_t) px;
+					p_pts[ num ][1] = (uint16_t) py;
+					num++;
+					acc = 0;
+				}
+				else
+				{
+					acc += d;
+					px = bx;
+					py = by;
+					i++;
+				}
+			}
+		}
+
+		// Rounding might leave last point out
+		while ( num < XPT2046_SHAPE_POINTS )
+		{
+			p_pts[ num ][0] = (uint16_t)((uint32_t) p_buf[ gp_shape->num - 1U ].x << XPT2046_SHAPE_Q );
+			p_pts[ num ][1] = (uint16_t)((uint32_t) p_buf[ gp_shape->num - 1U ].y << XPT2046_SHAPE_Q );
+			num++;
+		}
+	}
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Normalize resampled points into point cloud
+*
+* @note		Uniform scale to XPT2046_SHAPE_SCALE box, origin at centroid.
+*
+* @param[in]	p_pts	- Resampled points (Q4 pixel)
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_shape_normalize(const uint16_t (* const p_pts)[2])
+{
+	int32_t scaled[ XPT2046_SHAPE_POINTS ][2];
+	int32_t min[2] = { INT32_MAX, INT32_MAX };
+	int32_t max[2] = { 0, 0 };
+	int32_t sum[2] = { 0, 0 };
+	int32_t size;
+	int32_t c;
+	uint32_t i;
+	uint32_t a;
+
+	for ( i = 0; i < XPT2046_SHAPE_POINTS; i++ )
+	{
+		for ( a = 0; a < 2U; a++ )
+		{
+			min[a] = ( p_pts[i][a] < min[a] ) ? p_pts[i][a] : min[a];
+			max[a] = ( p_pts[i][a] > max[a] ) ? p_pts[i][a] : max[a];
+		}
+	}
+
+	size = (( max[0] - min[0] ) > ( max[1] - min[1] )) ? ( max[0] - min[0] ) : ( max[1] - min[1] );
+	size = ( size > 0 ) ? size : 1;
+
+	// Scale with rounding
+	for ( i = 0; i < XPT2046_SHAPE_POINTS; i++ )
+	{
+		for ( a = 0; a < 2U; a++ )
+		{
+			scaled[i][a] = ((( p_pts[i][a] - min[a] ) * XPT2046_SHAPE_SCALE ) + ( size / 2 )) / size;
+			sum[a] += scaled[i][a];
+		}
+	}
+
+	// Move to centroid, result is within +/- XPT2046_SHAPE_SCALE
+	for ( a = 0; a < 2U; a++ )
+	{
+		c = ( sum[a] + (int32_t)( XPT2046_SHAPE_POINTS / 2U )) / (int32_t) XPT2046_SHAPE_POINTS;
+
+		for ( i = 0; i < XPT2046_SHAPE_POINTS; i++ )
+		{
+			gp_shape->cloud[i][a] = (int8_t)( scaled[i][a] - c );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Advance matching against templates
+*
+* @note		Matches XPT2046_SHAPE_MATCH_STEPS start points per call,
+* 			publishes result after last template.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_shape_match(void)
+{
+	const int8_t (* p_tmpl)[2];
+	uint32_t steps;
+	uint32_t d1;
+	uint32_t d2;
+	uint32_t dist_zero;
+
+	for ( steps = 0; ( steps < XPT2046_SHAPE_MATCH_STEPS ) && ( true == gp_shape->match ); steps++ )
+	{
+		p_tmpl = gc_xpt2046_shape_tmpl[ gp_shape->tmpl ];
+
+		// Both directions, cloud sizes are equal
+		d1 = xpt2046_shape_cloud_dist((const int8_t (*)[2]) gp_shape->cloud, p_tmpl, gp_shape->start );
+		d2 = xpt2046_shape_cloud_dist( p_tmpl, (const int8_t (*)[2]) gp_shape->cloud, gp_shape->start );
+
+		d1 = ( d2 < d1 ) ? d2 : d1;
+		gp_shape->dist_tmpl = ( d1 < gp_shape->dist_tmpl ) ? d1 : gp_shape->dist_tmpl;
+
+		gp_shape->start += XPT2046_SHAPE_START_STEP;
+
+		// Template done
+		if ( gp_shape->start >= XPT2046_SHAPE_POINTS )
+		{
+			if ( gp_shape->dist_tmpl < gp_shape->dist_best )
+			{
+				gp_shape->dist_best = gp_shape->dist_tmpl;
+				gp_shape->best = gp_shape->tmpl;
+			}
+
+			gp_shape->dist_tmpl = UINT32_MAX;
+			gp_shape->start = 0;
+			gp_shape->tmpl++;
+
+			// All templates done
+			if ( gp_shape->tmpl >= XPT2046_SHAPE_TMPL_NUM )
+			{
+				dist_zero = XPT2046_SHAPE_DIST_ZERO * XPT2046_SHAPE_WEIGHT_SUM;
+
+				gp_shape->result.score = ( gp_shape->dist_best < dist_zero ) ? (uint8_t)(( 100U * ( dist_zero - gp_shape->dist_best )) / dist_zero ) : 0U;
+				gp_shape->result.id = ( gp_shape->result.score >= XPT2046_SHAPE_MIN_SCORE ) ? gp_shape->best : XPT2046_SHAPE_NONE;
+				gp_shape->result.strokes = gp_shape->cloud_strokes;
+				gp_shape->result_new = true;
+				gp_shape->match = false;
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Greedy cloud distance
+*
+* @note		Each point of A is matched to nearest unmatched point of B,
+* 			starting at given point. Early matches weigh more.
+*
+* @param[in]	p_a		- Point cloud A
+* @param[in]	p_b		- Point cloud B
+* @param[in]	start	- Start point in A
+* @return 		dist	- Weighted sum of distances
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_shape_cloud_dist(const int8_t (* const p_a)[2], const int8_t (* const p_b)[2], const uint32_t start)
+{
+	uint32_t matched = 0;
+	uint32_t dist = 0;
+	uint32_t i = start;
+	uint32_t j;
+	uint32_t k;
+	uint32_t j_min = 0;
+	uint32_t d_min;
+	uint32_t d;
+	int32_t dx;
+	int32_t dy;
+
+	for ( k = 0; k < XPT2046_SHAPE_POINTS; k++ )
+	{
+		d_min = UINT32_MAX;
+
+		for ( j = 0; j < XPT2046_SHAPE_POINTS; j++ )
+		{
+			if ( 0U == ( matched & ( 1UL << j )))
+			{
+				dx = (int32_t) p_a[i][0] - p_b[j][0];
+				dy = (int32_t) p_a[i][1] - p_b[j][1];
+				d = (uint32_t)( dx * dx + dy * dy );
+
+				if ( d < d_min )
+				{
+					d_min = d;
+					j_min = j;
+				}
+			}
+		}
+
+		matched |= ( 1UL << j_min );
+		dist += ( XPT2046_SHAPE_POINTS - k ) * xpt2046_shape_isqrt( d_min );
+
+		i = ( i + 1U ) % XPT2046_SHAPE_POINTS;
+	}
+
+	return dist;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Euclidean distance
+*
+* @param[in]	dx		- X difference
+* @param[in]	dy		- Y difference
+* @return 		dist	- Distance (floor)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_shape_dist(const int32_t dx, const int32_t dy)
+{
+	return xpt2046_shape_isqrt((uint32_t)( dx * dx ) + (uint32_t)( dy * dy ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Integer square root
+*
+* @param[in]	val		- Input value
+* @return 		root	- Floor of square root
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_shape_isqrt(const uint32_t val)
+{
+	uint32_t rem = val;
+	uint32_t root = 0;
+	uint32_t bit = ( 1UL << 30 );
+
+	while ( bit > rem )
+	{
+		bit >>= 2;
+	}
+
+	while ( 0U != bit )
+	{
+		if ( rem >= ( root + bit ))
+		{
+			rem -= ( root + bit );
+			root = ( root >> 1 ) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+#endif // 1 == XPT2046_SHAPE_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
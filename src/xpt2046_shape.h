@@ -0,0 +1,69 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_shape.h
+*@brief     Stroke shape recognizer for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_SHAPE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Stroke shape recognizer.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_SHAPE_H_
+#define _XPT2046_SHAPE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Normalized point cloud
+ *
+ * 	Gesture is resampled to XPT2046_SHAPE_POINTS equidistant points along
+ * 	its strokes, scaled uniformly so that larger side of bounding box
+ * 	is XPT2046_SHAPE_SCALE and moved to centroid. Templates generated by
+ * 	tools/shape/xpt2046_shape_gen.py use the same normalization.
+ */
+#define XPT2046_SHAPE_POINTS				( 32U )
+#define XPT2046_SHAPE_SCALE					( 127 )
+
+/**
+ * 	No template matched
+ */
+#define XPT2046_SHAPE_NONE					( 0xFFU )
+
+// Recognition result
+typedef struct
+{
+	uint8_t		id;			// Template index or XPT2046_SHAPE_NONE
+	uint8_t		score;		// Match score 0..100 of best template
+	uint8_t		strokes;	// Number of strokes of gesture
+} xpt2046_shape_result_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_shape_init			(void);
+xpt2046_status_t	xpt2046_shape_start			(void);
+void				xpt2046_shape_stop			(void);
+void				xpt2046_shape_add			(const uint16_t x, const uint16_t y, const bool pressed);
+xpt2046_status_t	xpt2046_shape_get			(xpt2046_shape_result_t * const p_result);
+const char *		xpt2046_shape_get_name		(const uint8_t id);
+
+#endif // _XPT2046_SHAPE_H_
@@ -0,0 +1,352 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_stream.c
+*@brief     Touch event streaming for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_STREAM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch event streaming.
+*
+* 	Events from event queue are encoded into compact byte stream for
+* 	low bandwidth links (UART, USB CDC), e.g. to mirror touch of device
+* 	on service computer. Host decoder is tools/stream/xpt2046_stream.py.
+*
+* 	Each stroke starts with key record holding absolute values, following
+* 	events are sent as delta records with varint coded changes. Each
+* 	record carries CRC, receiver drops corrupted data and continues at
+* 	next key record. Key record is also sent periodically and after lost
+* 	events, thus receiver joining stream at any time is in sync within
+* 	XPT2046_STREAM_KEY_INTERVAL records.
+*
+* 	Encoding time per event is bounded, record is never longer than
+* 	XPT2046_STREAM_REC_MAX bytes.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stddef.h>
+
+#include "xpt2046_stream.h"
+#include "xpt2046_evt.h"
+#include "xpt2046_mem.h"
+#include "../../xpt2046_cfg.h"
+
+#if ( 1 == XPT2046_STREAM_EN )
+
+#if ( 0 == XPT2046_EVT_EN )
+	#error "Touch streaming requires event queue (XPT2046_EVT_EN)!"
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Encoder state
+typedef struct
+{
+	uint32_t	timestamp;	// Last encoded event
+	uint32_t	lost;		// Lost events of queue at last record
+	uint16_t	x;
+	uint16_t	y;
+	uint16_t	pressure;
+	uint16_t	key_cnt;	// Records since last key record
+	bool		key_req;	// Next record shall be key record
+} xpt2046_stream_t;
+
+XPT2046_MEM_CHECK( stream, XPT2046_MEM_SIZE( sizeof( xpt2046_stream_t )), XPT2046_MEM_STREAM );
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Encoder state
+static xpt2046_stream_t * gp_stream = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_stream_put_key		(uint8_t * const p_buf, const xpt2046_evt_t * const p_evt);
+static uint32_t xpt2046_stream_put_delta	(uint8_t * const p_buf, const xpt2046_evt_t * const p_evt);
+static uint32_t xpt2046_stream_put_varint	(uint8_t * const p_buf, uint32_t val);
+static uint32_t xpt2046_stream_zigzag		(const int32_t val);
+static uint8_t	xpt2046_stream_crc8			(const uint8_t * const p_data, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize touch streaming
+*
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_stream_init(void)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+
+	gp_stream = xpt2046_mem_alloc( sizeof( xpt2046_stream_t ));
+
+	if ( NULL == gp_stream )
+	{
+		status = eXPT2046_ERROR;
+	}
+	else
+	{
+		gp_stream->key_req = true;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Encode queued touch events into stream
+*
+* @note		Streaming is consumer of event queue, thus events shall not
+* 			be taken with xpt2046_evt_get() at the same time. Only whole
+* 			records are written to buffer, at least XPT2046_STREAM_REC_MAX
+* 			bytes are needed to encode any event.
+*
+* @param[out]	p_buf	- Pointer to buffer
+* @param[in]	size	- Size of buffer in bytes
+* @param[out]	p_len	- Number of bytes written
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_stream_encode(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len)
+{
+	xpt2046_status_t status = eXPT2046_OK;
+	xpt2046_evt_t evt;
+	uint32_t len = 0;
+	uint32_t lost;
+
+	if 	(	( NULL != p_buf )
+		&&	( NULL != p_len )
+		&&	( NULL != gp_stream ))
+	{
+		while 	(	(( size - len ) >= XPT2046_STREAM_REC_MAX )
+				&&	( eXPT2046_OK == xpt2046_evt_get( &evt )))
+		{
+			// Missing events -> receiver needs absolute values
+			lost = xpt2046_evt_get_lost();
+
+			if ( lost != gp_stream->lost )
+			{
+				gp_stream->lost = lost;
+				gp_stream->key_req = true;
+			}
+
+			if 	(	( true == gp_stream->key_req )
+				||	( eXPT2046_EVT_DOWN == evt.type )
+				||	( gp_stream->key_cnt >= XPT2046_STREAM_KEY_INTERVAL ))
+			{
+				len += xpt2046_stream_put_key( &p_buf[ len ], &evt );
+
+				gp_stream->key_req = false;
+				gp_stream->key_cnt = 0;
+			}
+			else
+			{
+				len += xpt2046_stream_put_delta( &p_buf[ len ], &evt );
+
+				gp_stream->key_cnt++;
+			}
+
+			gp_stream->timestamp 	= evt.timestamp;
+			gp_stream->x 			= evt.x;
+			gp_stream->y 			= evt.y;
+			gp_stream->pressure 	= evt.pressure;
+		}
+
+		*p_len = len;
+	}
+	else
+	{
+		status = eXPT2046_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Restart stream
+*
+* @note		Next event is sent as key record. Shall be called when
+* 			receiver (re)connects or stream data was dropped on link.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_stream_reset(void)
+{
+	if ( NULL != gp_stream )
+	{
+		gp_stream->key_req = true;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write key record
+*
+* @param[out]	p_buf	- Pointer to buffer
+* @param[in]	p_evt	- Pointer to event
+* @return 		len		- Record length
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_stream_put_key(uint8_t * const p_buf, const xpt2046_evt_t * const p_evt)
+{
+	p_buf[0] 	= XPT2046_STREAM_SYNC_0;
+	p_buf[1] 	= XPT2046_STREAM_SYNC_1;
+	p_buf[2] 	= (uint8_t) p_evt->type;
+	p_buf[3] 	= (uint8_t)( p_evt->timestamp );
+	p_buf[4] 	= (uint8_t)( p_evt->timestamp >> 8 );
+	p_buf[5] 	= (uint8_t)( p_evt->timestamp >> 16 );
+	p_buf[6] 	= (uint8_t)( p_evt->timestamp >> 24 );
+	p_buf[7] 	= (uint8_t)( p_evt->x );
+	p_buf[8] 	= (uint8_t)( p_evt->x >> 8 );
+	p_buf[9] 	= (uint8_t)( p_evt->y );
+	p_buf[10] 	= (uint8_t)( p_evt->y >> 8 );
+	p_buf[11] 	= (uint8_t)( p_evt->pressure );
+	p_buf[12] 	= (uint8_t)( p_evt->pressure >> 8 );
+	p_buf[13] 	= xpt2046_stream_crc8( p_buf, XPT2046_STREAM_KEY_SIZE - 1U );
+
+	return XPT2046_STREAM_KEY_SIZE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write delta record
+*
+* @note		Pressure delta is sent only when pressure changed.
+*
+* @param[out]	p_buf	- Pointer to buffer
+* @param[in]	p_evt	- Pointer to event
+* @return 		len		- Record length
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_stream_put_delta(uint8_t * const p_buf, const xpt2046_evt_t * const p_evt)
+{
+	uint32_t len = 1;
+
+	p_buf[0] = (uint8_t)( XPT2046_STREAM_DELTA_TAG | ((uint32_t) p_evt->type << XPT2046_STREAM_DELTA_TYPE_SHIFT ));
+
+	len += xpt2046_stream_put_varint( &p_buf[ len ], p_evt->timestamp - gp_stream->timestamp );
+	len += xpt2046_stream_put_varint( &p_buf[ len ], xpt2046_stream_zigzag((int32_t) p_evt->x - (int32_t) gp_stream->x ));
+	len += xpt2046_stream_put_varint( &p_buf[ len ], xpt2046_stream_zigzag((int32_t) p_evt->y - (int32_t) gp_stream->y ));
+
+	if ( p_evt->pressure != gp_stream->pressure )
+	{
+		p_buf[0] |= XPT2046_STREAM_DELTA_PRESSURE;
+		len += xpt2046_stream_put_varint( &p_buf[ len ], xpt2046_stream_zigzag((int32_t) p_evt->pressure - (int32_t) gp_stream->pressure ));
+	}
+
+	p_buf[ len ] = xpt2046_stream_crc8( p_buf, len );
+	len++;
+
+	return len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write varint
+*
+* @param[out]	p_buf	- Pointer to buffer
+* @param[in]	val		- Value
+* @return 		len		- Number of bytes written (1..5)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_stream_put_varint(uint8_t * const p_buf, uint32_t val)
+{
+	uint32_t len = 0;
+
+	while ( val >= 0x80U )
+	{
+		p_buf[ len++ ] = (uint8_t)( val | 0x80U );
+		val >>= 7;
+	}
+
+	p_buf[ len++ ] = (uint8_t) val;
+
+	return len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Zigzag mapping of signed value
+*
+* @note		Small values of both signs map to small unsigned values:
+* 			0, -1, 1, -2, 2... -> 0, 1, 2, 3, 4...
+*
+* @param[in]	val		- Signed value
+* @return 		zz		- Mapped value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_stream_zigzag(const int32_t val)
+{
+	uint32_t zz;
+
+	if ( val < 0 )
+	{
+		zz = ((uint32_t)( -val ) << 1 ) - 1U;
+	}
+	else
+	{
+		zz = (uint32_t) val << 1;
+	}
+
+	return zz;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC-8
+*
+* @note		Polynomial 0x07, initial value 0x00.
+*
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data
+* @return 		crc		- CRC-8
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t xpt2046_stream_crc8(const uint8_t * const p_data, const uint32_t size)
+{
+	uint8_t crc = 0;
+	uint32_t i;
+	uint32_t b;
+
+	for ( i = 0; i < size; i++ )
+	{
+		crc ^= p_data[i];
+
+		for ( b = 0; b < 8U; b++ )
+		{
+			crc = ( 0U != ( crc & 0x80U )) ? (uint8_t)(( crc << 1 ) ^ 0x07U ) : (uint8_t)( crc << 1 );
+		}
+	}
+
+	return crc;
+}
+
+#endif // 1 == XPT2046_STREAM_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
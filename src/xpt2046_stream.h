@@ -0,0 +1,78 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_stream.h
+*@brief     Touch event streaming for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_STREAM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch event streaming.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_STREAM_H_
+#define _XPT2046_STREAM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "xpt2046.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Stream record layout (little endian)
+ *
+ * 	Key record, absolute values (14 bytes):
+ *
+ * 		[0..1]	Sync XPT2046_STREAM_SYNC_0, XPT2046_STREAM_SYNC_1
+ * 		[2]		Event type
+ * 		[3..6]	Timestamp [ms]
+ * 		[7..8]	X
+ * 		[9..10]	Y
+ * 		[11..12]Pressure
+ * 		[13]	CRC-8 of bytes 0..12
+ *
+ * 	Delta record, change from previous record (5..16 bytes):
+ *
+ * 		Header	10TT P000 (TT - event type, P - pressure delta follows)
+ * 		Varint time delta [ms]
+ * 		Zigzag varint X delta
+ * 		Zigzag varint Y delta
+ * 		Zigzag varint pressure delta (only when P is set)
+ * 		CRC-8 of all previous bytes of record
+ *
+ * 	Varint holds 7 bits per byte, least significant first, MSB set on
+ * 	all but last byte. CRC-8 polynomial is 0x07 with zero initial value.
+ */
+#define XPT2046_STREAM_SYNC_0				( 0xC3U )
+#define XPT2046_STREAM_SYNC_1				( 0x5AU )
+#define XPT2046_STREAM_KEY_SIZE				( 14U )
+
+#define XPT2046_STREAM_DELTA_TAG			( 0x80U )
+#define XPT2046_STREAM_DELTA_TAG_MASK		( 0xC0U )
+#define XPT2046_STREAM_DELTA_TYPE_SHIFT		( 4U )
+#define XPT2046_STREAM_DELTA_PRESSURE		( 0x08U )
+
+// Max. size of single record
+#define XPT2046_STREAM_REC_MAX				( 16U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_stream_init			(void);
+xpt2046_status_t	xpt2046_stream_encode		(uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len);
+void				xpt2046_stream_reset		(void);
+
+#endif // _XPT2046_STREAM_H_
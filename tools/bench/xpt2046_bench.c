@@ -0,0 +1,597 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_bench.c
+*@brief     Touch pipeline benchmark for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch pipeline benchmark.
+*
+* 	Runs touch handler against simulated XPT2046 chip (SPI byte level,
+* 	same framing as virtual device server) with deterministic touch
+* 	script and measures each pipeline stage with XPT2046_PROF_BEGIN/END
+* 	hooks. Counter comes from target part:
+*
+* 		- xpt2046_bench_cm.c:	Cortex-M under QEMU (instructions) or on
+* 								board (DWT cycles)
+* 		- xpt2046_bench_host.c:	host (nanoseconds)
+*
+* 	Build and run for all configuration profiles with
+* 	tools/bench/xpt2046_bench.py, which also parses report below:
+*
+* 		BENCH BEGIN
+* 		BENCH OVERHEAD <counts>
+* 		BENCH STAGE <name> <calls> <sum> <min> <max>
+* 		BENCH END
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "xpt2046_bench.h"
+#include "xpt2046_if.h"
+#include "xpt2046/src/xpt2046.h"
+#include "xpt2046/src/xpt2046_evt.h"
+#include "xpt2046/src/xpt2046_stream.h"
+#include "xpt2046_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of touch handler cycles
+#ifndef XPT2046_BENCH_CYCLES
+	#define XPT2046_BENCH_CYCLES		( 2000U )
+#endif
+
+// Touch script period in handler cycles: idle, stroke, idle
+#define XPT2046_BENCH_IDLE				( 20U )
+#define XPT2046_BENCH_STROKE			( 120U )
+#define XPT2046_BENCH_PERIOD			( XPT2046_BENCH_IDLE + XPT2046_BENCH_STROKE + XPT2046_BENCH_IDLE )
+
+// Simulated chip
+#define XPT2046_BENCH_CTRL_S			( 0x80U )
+#define XPT2046_BENCH_CTRL_ADDR(c)		((( c ) >> 4 ) & 0x07U )
+#define XPT2046_BENCH_CTRL_MODE_8BIT(c)	( 0U != (( c ) & 0x08U ))
+#define XPT2046_BENCH_ADC_MAX			( 4095 )
+#define XPT2046_BENCH_Z2_REF			( 3000U )
+#define XPT2046_BENCH_NOISE				( 6U )
+
+// Channel addresses
+enum
+{
+	eXPT2046_BENCH_CH_Y = 1,
+	eXPT2046_BENCH_CH_Z1 = 3,
+	eXPT2046_BENCH_CH_Z2 = 4,
+	eXPT2046_BENCH_CH_X = 5,
+};
+
+// Stage index of whole touch handler
+#define XPT2046_BENCH_HNDL				( eXPT2046_PROF_NUM_OF )
+#define XPT2046_BENCH_NUM_OF			( eXPT2046_PROF_NUM_OF + 1U )
+
+// Stage statistics
+typedef struct
+{
+	uint32_t	start;
+	uint32_t	pairs;		// Completed pairs at begin
+	uint32_t	calls;
+	uint32_t	sum;
+	uint32_t	min;
+	uint32_t	max;
+} xpt2046_bench_stat_t;
+
+// Simulated chip state
+typedef struct
+{
+	bool		pressed;
+	uint16_t	x;
+	uint16_t	y;
+	uint16_t	rt;
+	uint16_t	shift;
+	uint32_t	rand;
+} xpt2046_bench_chip_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Stage statistics
+static xpt2046_bench_stat_t g_stat[ XPT2046_BENCH_NUM_OF ];
+
+// Names of stages in report
+static const char * const gc_stage_name[ XPT2046_BENCH_NUM_OF ] =
+{
+	"ACQUIRE",
+	"CONTACT",
+	"FILTER",
+	"CALIBRATE",
+	"OUTPUT",
+	"EVENTS",
+	"HNDL",
+};
+
+// Counter overhead of begin/end pair
+static uint32_t g_overhead = 0;
+
+// Completed begin/end pairs
+static uint32_t g_pairs = 0;
+
+// Simulated chip
+static xpt2046_bench_chip_t g_chip = { .rand = 12345U };
+
+// Virtual time
+static uint32_t g_tick_ms = 0;
+static uint32_t g_tick_us = 0;
+
+// Calibration factors: 12-bit raw range to 480 x 320 display
+static const int32_t gc_cal_factors[7] = { 4096, 480, 0, 0, 0, 320, 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void		xpt2046_bench_script	(const uint32_t cycle);
+static void		xpt2046_bench_drain		(void);
+static void		xpt2046_bench_measure_overhead	(void);
+static void		xpt2046_bench_report	(void);
+static void		xpt2046_bench_write_u32	(const uint32_t val);
+static uint16_t	xpt2046_bench_convert	(const uint8_t ctrl);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Benchmark entry
+*
+* @return 		0 on success
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+	uint32_t cycle;
+	uint32_t i;
+
+	for ( i = 0; i < XPT2046_BENCH_NUM_OF; i++ )
+	{
+		g_stat[i].min = UINT32_MAX;
+	}
+
+	if ( eXPT2046_OK != xpt2046_init())
+	{
+		xpt2046_bench_write( "BENCH ERROR init\n" );
+		xpt2046_bench_exit( 1 );
+	}
+
+	xpt2046_set_cal_factors( gc_cal_factors );
+
+	xpt2046_bench_measure_overhead();
+
+	for ( cycle = 0; cycle < XPT2046_BENCH_CYCLES; cycle++ )
+	{
+		xpt2046_bench_script( cycle );
+
+		xpt2046_bench_prof_begin( XPT2046_BENCH_HNDL );
+		xpt2046_hndl();
+		xpt2046_bench_prof_end( XPT2046_BENCH_HNDL );
+
+		xpt2046_bench_drain();
+
+		g_tick_ms += XPT2046_HNDL_PERIOD_MS;
+		g_tick_us += ( 1000U * XPT2046_HNDL_PERIOD_MS );
+	}
+
+	xpt2046_bench_report();
+	xpt2046_bench_exit( 0 );
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get virtual system tick
+*
+* @return 		tick - Time in ms
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_bench_get_tick(void)
+{
+	return g_tick_ms;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get virtual microsecond tick
+*
+* @note		Advances on each read, thus busy waits of driver end.
+*
+* @return 		tick - Time in us
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_bench_get_us_tick(void)
+{
+	g_tick_us++;
+
+	return g_tick_us;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stage begin hook
+*
+* @param[in]	stage	- Pipeline stage
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_prof_begin(const uint32_t stage)
+{
+	g_stat[ stage ].pairs = g_pairs;
+	g_stat[ stage ].start = xpt2046_bench_cnt();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stage end hook
+*
+* @note		Overhead of own and nested begin/end pairs is subtracted.
+*
+* @param[in]	stage	- Pipeline stage
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_prof_end(const uint32_t stage)
+{
+	xpt2046_bench_stat_t * const p_stat = &g_stat[ stage ];
+	uint32_t cnt = xpt2046_bench_cnt() - p_stat->start;
+	const uint32_t corr = g_overhead * ( g_pairs - p_stat->pairs + 1U );
+
+	cnt = ( cnt > corr ) ? ( cnt - corr ) : 0U;
+	g_pairs++;
+
+	p_stat->calls++;
+	p_stat->sum += cnt;
+
+	if ( cnt < p_stat->min )
+	{
+		p_stat->min = cnt;
+	}
+
+	if ( cnt > p_stat->max )
+	{
+		p_stat->max = cnt;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Empty hook (e.g. ink drawing)
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_nop(void)
+{
+	// No actions...
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize simulated chip interface
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_if_init(void)
+{
+	return eXPT2046_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transmit and receive bytes over SPI
+*
+* @note		Each byte is clocked through simulated chip: control byte
+* 			starts conversion, result is shifted out in following two
+* 			bytes (12-bit result in bits 14..3, 8-bit in bits 14..7).
+*
+* @param[in]	p_tx		- Pointer to transmit data
+* @param[out]	p_rx		- Pointer to receive data
+* @param[in]	size		- Number of bytes
+* @param[in]	cs_action	- Chip select action
+* @return 		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_if_spi_transmit_receive(const uint8_t * p_tx, uint8_t * const p_rx, const uint32_t size, const spi_cs_action_t cs_action)
+{
+	uint32_t i;
+	uint16_t adc;
+
+	(void) cs_action;
+
+	for ( i = 0; i < size; i++ )
+	{
+		p_rx[i] = (uint8_t)( g_chip.shift >> 8 );
+		g_chip.shift = (uint16_t)( g_chip.shift << 8 );
+
+		if ( 0U != ( p_tx[i] & XPT2046_BENCH_CTRL_S ))
+		{
+			adc = xpt2046_bench_convert( p_tx[i] );
+
+			if ( true == XPT2046_BENCH_CTRL_MODE_8BIT( p_tx[i] ))
+			{
+				g_chip.shift = (uint16_t)(( adc >> 4 ) << 7 );
+			}
+			else
+			{
+				g_chip.shift = (uint16_t)( adc << 3 );
+			}
+		}
+	}
+
+	return eXPT2046_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get touch interrupt (PENIRQ) state
+*
+* @return 		touch_int - True when panel is pressed
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool xpt2046_if_get_int(void)
+{
+	return g_chip.pressed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set SPI clock
+*
+* @note		Simulated chip has no settling, setting is ignored.
+*
+* @param[in]	idx		- Clock setting, 0 is slowest
+* @return 		status	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_if_spi_set_clk(const uint8_t idx)
+{
+	(void) idx;
+
+	return eXPT2046_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Apply touch script for handler cycle
+*
+* @note		Idle, then diagonal stroke with slowly rising pressure, then
+* 			idle. Stroke has short resting part to exercise lock and
+* 			classification.
+*
+* @param[in]	cycle	- Handler cycle
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_bench_script(const uint32_t cycle)
+{
+	const uint32_t phase = cycle % XPT2046_BENCH_PERIOD;
+	uint32_t pos;
+
+	if 	(	( phase >= XPT2046_BENCH_IDLE )
+		&&	( phase < ( XPT2046_BENCH_IDLE + XPT2046_BENCH_STROKE )))
+	{
+		pos = phase - XPT2046_BENCH_IDLE;
+
+		// Rest in the middle of stroke
+		if (( pos > 50U ) && ( pos < 70U ))
+		{
+			pos = 50U;
+		}
+
+		g_chip.pressed 	= true;
+		g_chip.x 		= (uint16_t)( 600U + ( 20U * pos ));
+		g_chip.y 		= (uint16_t)( 800U + ( 15U * pos ));
+		g_chip.rt 		= (uint16_t)( 900U - ( 4U * pos ));
+	}
+	else
+	{
+		g_chip.pressed = false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Consume events generated by touch handler
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_bench_drain(void)
+{
+	#if ( 1 == XPT2046_STREAM_EN )
+		uint8_t buf[ 8U * XPT2046_STREAM_REC_MAX ];
+		uint32_t len;
+
+		(void) xpt2046_stream_encode( buf, sizeof( buf ), &len );
+
+	#elif ( 1 == XPT2046_EVT_EN )
+		xpt2046_evt_t evt;
+
+		while ( eXPT2046_OK == xpt2046_evt_get( &evt ))
+		{
+			// No actions...
+		}
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Measure cost of empty begin/end pair
+*
+* @note		Minimum over several pairs, subtracted from each measurement.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_bench_measure_overhead(void)
+{
+	xpt2046_bench_stat_t * const p_stat = &g_stat[ XPT2046_BENCH_HNDL ];
+	uint32_t i;
+
+	for ( i = 0; i < 16U; i++ )
+	{
+		xpt2046_bench_prof_begin( XPT2046_BENCH_HNDL );
+		xpt2046_bench_prof_end( XPT2046_BENCH_HNDL );
+	}
+
+	g_overhead = p_stat->min;
+
+	p_stat->calls 	= 0;
+	p_stat->sum 	= 0;
+	p_stat->min 	= UINT32_MAX;
+	p_stat->max 	= 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write report
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_bench_report(void)
+{
+	uint32_t i;
+
+	xpt2046_bench_write( "BENCH BEGIN\nBENCH OVERHEAD " );
+	xpt2046_bench_write_u32( g_overhead );
+	xpt2046_bench_write( "\n" );
+
+	for ( i = 0; i < XPT2046_BENCH_NUM_OF; i++ )
+	{
+		// Stage compiled out
+		if ( 0U == g_stat[i].calls )
+		{
+			g_stat[i].min = 0;
+		}
+
+		xpt2046_bench_write( "BENCH STAGE " );
+		xpt2046_bench_write( gc_stage_name[i] );
+		xpt2046_bench_write( " " );
+		xpt2046_bench_write_u32( g_stat[i].calls );
+		xpt2046_bench_write( " " );
+		xpt2046_bench_write_u32( g_stat[i].sum );
+		xpt2046_bench_write( " " );
+		xpt2046_bench_write_u32( g_stat[i].min );
+		xpt2046_bench_write( " " );
+		xpt2046_bench_write_u32( g_stat[i].max );
+		xpt2046_bench_write( "\n" );
+	}
+
+	xpt2046_bench_write( "BENCH END\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write unsigned decimal number
+*
+* @note		Target output might have no printf (semihosting).
+*
+* @param[in]	val		- Value
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_bench_write_u32(const uint32_t val)
+{
+	char str[11];
+	uint32_t v = val;
+	uint32_t i = sizeof( str ) - 1U;
+
+	str[i] = '\0';
+
+	do
+	{
+		i--;
+		str[i] = (char)( '0' + ( v % 10U ));
+		v /= 10U;
+	} while ( v > 0U );
+
+	xpt2046_bench_write( &str[i] );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert selected channel of simulated chip
+*
+* @param[in]	ctrl	- Control byte
+* @return 		adc		- 12-bit conversion result
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t xpt2046_bench_convert(const uint8_t ctrl)
+{
+	int32_t adc;
+	int32_t noise;
+
+	// Deterministic noise (LCG)
+	g_chip.rand = ( g_chip.rand * 1103515245U ) + 12345U;
+	noise = (int32_t)(( g_chip.rand >> 16 ) % ( 2U * XPT2046_BENCH_NOISE + 1U )) - (int32_t) XPT2046_BENCH_NOISE;
+
+	switch( XPT2046_BENCH_CTRL_ADDR( ctrl ))
+	{
+		case eXPT2046_BENCH_CH_X:
+			adc = ( true == g_chip.pressed ) ? ( g_chip.x + noise ) : 0;
+			break;
+
+		case eXPT2046_BENCH_CH_Y:
+			adc = ( true == g_chip.pressed ) ? ( g_chip.y + noise ) : 0;
+			break;
+
+		case eXPT2046_BENCH_CH_Z1:
+			// Z1 such that X * ( Z2 - Z1 ) / Z1 == rt
+			adc = ( true == g_chip.pressed ) ? (int32_t)(( XPT2046_BENCH_Z2_REF * g_chip.x ) / ((uint32_t) g_chip.x + g_chip.rt + 1U )) : 0;
+			break;
+
+		case eXPT2046_BENCH_CH_Z2:
+			adc = ( true == g_chip.pressed ) ? (int32_t) XPT2046_BENCH_Z2_REF : XPT2046_BENCH_ADC_MAX;
+			break;
+
+		default:
+			adc = 0;
+			break;
+	}
+
+	if ( adc < 0 )
+	{
+		adc = 0;
+	}
+	else if ( adc > XPT2046_BENCH_ADC_MAX )
+	{
+		adc = XPT2046_BENCH_ADC_MAX;
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return (uint16_t) adc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_bench.h
+*@brief     Touch pipeline benchmark for XPT2046
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Touch pipeline benchmark.
+*
+* 	Included by generated configuration (xpt2046_cfg.h) in place of
+* 	project configuration, see tools/bench/xpt2046_bench.py.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_BENCH_H_
+#define _XPT2046_BENCH_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Types of project configuration
+typedef float float32_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+
+// Benchmark (xpt2046_bench.c)
+uint32_t	xpt2046_bench_get_tick		(void);
+uint32_t	xpt2046_bench_get_us_tick	(void);
+void		xpt2046_bench_prof_begin	(const uint32_t stage);
+void		xpt2046_bench_prof_end		(const uint32_t stage);
+void		xpt2046_bench_nop			(void);
+
+// Target (xpt2046_bench_cm.c or xpt2046_bench_host.c)
+uint32_t	xpt2046_bench_cnt			(void);
+void		xpt2046_bench_write			(const char * const p_str);
+void		xpt2046_bench_exit			(const int32_t code);
+
+#endif // _XPT2046_BENCH_H_
@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+#
+#  @file      xpt2046_bench.py
+#  @brief     Touch pipeline benchmark runner for XPT2046
+#  @author    Ziga Miklosic
+#  @date      18.10.2026
+#  @version   V1.1.0
+#
+################################################################################
+"""
+Build touch pipeline benchmark for each configuration profile and target,
+run it and report cost of each pipeline stage per touch handler call.
+
+Targets:
+    m4      Cortex-M4F, QEMU mps2-an386
+    m7      Cortex-M7F, QEMU mps2-an500
+    host    native build, nanoseconds (checks benchmark without toolchain)
+
+QEMU does not model pipeline timing. With "-icount" it runs exactly one
+instruction per 2^shift ns of virtual time, which SysTick of the board
+counts, thus benchmark reports exact instruction counts. Cycles are
+estimated as instructions * CPI of core (--cpi), calibrate CPI once with
+DWT build on board (-DXPT2046_BENCH_CNT_DWT).
+
+Configuration is generated from template/xpt2046_cfg.htmp with profile
+overrides, thus new options of template are picked up automatically.
+
+Usage:
+    xpt2046_bench.py                            all profiles on m4 and m7
+    xpt2046_bench.py -t host -p default
+    xpt2046_bench.py -o bench.json              save results
+    xpt2046_bench.py -b bench.json -r 5         fail on >5 % regression
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+BENCH_DIR = os.path.join(ROOT, "tools", "bench")
+TEMPLATE = os.path.join(ROOT, "template", "xpt2046_cfg.htmp")
+SHAPE_GEN = os.path.join(ROOT, "tools", "shape", "xpt2046_shape_gen.py")
+
+STAGES = ("ACQUIRE", "CONTACT", "FILTER", "CALIBRATE", "OUTPUT", "EVENTS", "HNDL")
+
+ARM_FLAGS = ["-mthumb", "-O2", "-g", "-ffunction-sections", "-fdata-sections", "-nostartfiles",
+             "-Wl,--gc-sections", "--specs=nano.specs", "--specs=nosys.specs",
+             "-T", os.path.join(BENCH_DIR, "xpt2046_bench.ld")]
+
+# name: compiler, flags, target source, QEMU board, default CPI, unit
+TARGETS = {
+    "m4": ("arm-none-eabi-gcc", ["-mcpu=cortex-m4", "-mfpu=fpv4-sp-d16", "-mfloat-abi=hard"] + ARM_FLAGS,
+           "xpt2046_bench_cm.c", "mps2-an386", 1.3, "insn"),
+    "m7": ("arm-none-eabi-gcc", ["-mcpu=cortex-m7", "-mfpu=fpv5-d16", "-mfloat-abi=hard"] + ARM_FLAGS,
+           "xpt2046_bench_cm.c", "mps2-an500", 0.9, "insn"),
+    "host": ("gcc", ["-O2", "-g"], "xpt2046_bench_host.c", None, None, "ns"),
+}
+
+# Options fixed for benchmark
+COMMON = {
+    "XPT2046_DEBUG_EN": "( 0 )",
+    "XPT2046_ASSERT_EN": "( 0 )",
+    "XPT2046_CAL_GUI_EN": "( 0 )",
+    "XPT2046_PROF_EN": "( 1 )",
+    "XPT2046_GET_SYSTICK": "( xpt2046_bench_get_tick() )",
+    "XPT2046_GET_US_TICK": "( xpt2046_bench_get_us_tick() )",
+    "XPT2046_INK_DRAW_SPAN": "( xpt2046_bench_nop() )",
+    "XPT2046_PROF_BEGIN": "( xpt2046_bench_prof_begin((uint32_t)( stage )))",
+    "XPT2046_PROF_END": "( xpt2046_bench_prof_end((uint32_t)( stage )))",
+}
+
+# Features which can not be enabled in benchmark
+FULL_EXCLUDE = ("XPT2046_ADC_EN", "XPT2046_CAL_BAKED_EN", "XPT2046_CAL_BAKED_OVERRIDE_EN", "XPT2046_MEM_EXT_EN")
+
+# Template includes replaced by benchmark header
+INCLUDE_RE = re.compile(r'^#include\s+"(project_config\.h|drivers/.*|middleware/.*)"', re.M)
+
+# Feature enable options of template
+FEATURE_RE = re.compile(r'^#define\s+(XPT2046_\w+_EN)\s', re.M)
+
+
+def profiles(template):
+    """ Return profile name -> overrides """
+    features = [f for f in FEATURE_RE.findall(template) if f not in COMMON and f not in FULL_EXCLUDE]
+
+    return {
+        "min": dict({f: "( 0 )" for f in features}, XPT2046_FILTER_EN="( 1 )"),
+        "default": {},
+        "full": {f: "( 1 )" for f in features},
+    }
+
+
+def gen_cfg(template, overrides):
+    """ Apply overrides to configuration template """
+    text = INCLUDE_RE.sub(lambda m: '#include "xpt2046_bench.h"' if "project_config.h" == m.group(1) else "", template)
+
+    for name, val in dict(COMMON, **overrides).items():
+        line_re = re.compile(r'^(#define\s+%s\b(?:\([^)]*\))?\s+).*$' % name, re.M)
+        text, num = line_re.subn(lambda m: m.group(1) + val, text, count=1)
+        if 0 == num:
+            raise ValueError("option %s not in template" % name)
+
+    return text
+
+
+def build(target, profile, cfg, out_dir, cycles):
+    """ Build benchmark, return path of executable """
+    cc, flags, tgt_src, _, _, _ = TARGETS[target]
+    bdir = os.path.join(out_dir, "%s-%s" % (target, profile))
+
+    # Library must sit next to user files (includes "../../xpt2046_cfg.h")
+    shutil.rmtree(bdir, ignore_errors=True)
+    shutil.copytree(os.path.join(ROOT, "src"), os.path.join(bdir, "xpt2046", "src"))
+    shutil.copy(os.path.join(BENCH_DIR, "xpt2046_if_bench.h"), os.path.join(bdir, "xpt2046_if.h"))
+
+    with open(os.path.join(bdir, "xpt2046_cfg.h"), "w") as f:
+        f.write(cfg)
+
+    # Built-in shape recognizer templates
+    subprocess.run([sys.executable, SHAPE_GEN, "-o", os.path.join(bdir, "xpt2046_shape_tmpl.h")], check=True)
+
+    src_dir = os.path.join(bdir, "xpt2046", "src")
+    srcs = sorted(os.path.join(src_dir, s) for s in os.listdir(src_dir) if s.endswith(".c"))
+    srcs += [os.path.join(BENCH_DIR, "xpt2046_bench.c"), os.path.join(BENCH_DIR, tgt_src)]
+    exe = os.path.join(bdir, "xpt2046_bench.elf")
+
+    cmd = [cc, "-std=gnu99", "-I" + bdir, "-I" + BENCH_DIR, "-DXPT2046_BENCH_CYCLES=%dU" % cycles] + flags + srcs + ["-o", exe]
+    subprocess.run(cmd, check=True)
+
+    return exe
+
+
+def run(target, exe, shift):
+    """ Run benchmark, return report lines """
+    board = TARGETS[target][3]
+
+    if board is None:
+        cmd = [exe]
+    else:
+        cmd = ["qemu-system-arm", "-M", board, "-nographic", "-monitor", "none", "-serial", "none",
+               "-semihosting-config", "enable=on,target=native", "-icount", "shift=%d" % shift, "-kernel", exe]
+
+    res = subprocess.run(cmd, check=True, stdout=subprocess.PIPE, universal_newlines=True, timeout=600)
+
+    return res.stdout.splitlines()
+
+
+def parse(lines, scale):
+    """ Parse report, return stage -> statistics """
+    stages = {}
+    done = False
+
+    for line in lines:
+        tok = line.split()
+        if len(tok) < 2 or "BENCH" != tok[0]:
+            continue
+        if "STAGE" == tok[1]:
+            calls, total, vmin, vmax = (int(v) for v in tok[3:7])
+            stages[tok[2]] = {
+                "calls": calls,
+                "mean": (total * scale / calls) if calls else 0.0,
+                "min": vmin * scale,
+                "max": vmax * scale,
+            }
+        elif "FAIL" == tok[1] or "ERROR" == tok[1]:
+            raise RuntimeError(line)
+        elif "END" == tok[1]:
+            done = True
+
+    if not done:
+        raise RuntimeError("incomplete report")
+
+    return stages
+
+
+def report(results, cpis):
+    """ Print table per target and profile """
+    for key, stages in results.items():
+        target = key.split("/")[0]
+        unit = TARGETS[target][5]
+        cpi = cpis.get(target)
+
+        print("\n%s  [%s per call%s]" % (key, unit, ", est. cycles at CPI %.2f" % cpi if cpi else ""))
+        print("  %-10s %7s %10s %10s %10s %s" % ("stage", "calls", "mean", "min", "max", " cycles" if cpi else ""))
+
+        for name in STAGES:
+            s = stages.get(name)
+            if s is None or 0 == s["calls"]:
+                continue
+            cyc = " %10.0f" % (s["mean"] * cpi) if cpi else ""
+            print("  %-10s %7d %10.1f %10.0f %10.0f%s" % (name, s["calls"], s["mean"], s["min"], s["max"], cyc))
+
+
+def compare(results, baseline, limit):
+    """ Return list of stages which got slower than limit in percent """
+    slower = []
+
+    for key, stages in results.items():
+        for name, s in stages.items():
+            ref = baseline.get(key, {}).get(name)
+            if ref is None or 0 == ref["mean"]:
+                continue
+            diff = 100.0 * (s["mean"] - ref["mean"]) / ref["mean"]
+            if diff > limit:
+                slower.append("%s %s: %.1f -> %.1f (+%.1f %%)" % (key, name, ref["mean"], s["mean"], diff))
+
+    return slower
+
+
+def main():
+    parser = argparse.ArgumentParser(description="XPT2046 touch pipeline benchmark")
+    parser.add_argument("-t", "--target", action="append", choices=sorted(TARGETS), help="target (default m4 and m7)")
+    parser.add_argument("-p", "--profile", action="append", help="configuration profile: min, default, full (default all)")
+    parser.add_argument("-n", "--cycles", type=int, default=2000, help="touch handler calls")
+    parser.add_argument("-s", "--shift", type=int, default=6, help="QEMU icount shift, 2^shift ns per instruction")
+    parser.add_argument("--sysclk", type=float, default=25e6, help="SysTick clock of QEMU board in Hz")
+    parser.add_argument("--cpi", action="append", default=[], metavar="TARGET=CPI", help="cycles per instruction estimate")
+    parser.add_argument("-d", "--dir", default="_bench", help="build directory")
+    parser.add_argument("-o", "--output", help="save results as JSON")
+    parser.add_argument("-b", "--baseline", help="compare with saved JSON results")
+    parser.add_argument("-r", "--regression", type=float, default=5.0, help="allowed slowdown in percent")
+    args = parser.parse_args()
+
+    with open(TEMPLATE) as f:
+        template = f.read()
+
+    profs = profiles(template)
+    targets = args.target or ["m4", "m7"]
+    names = args.profile or list(profs)
+    cpis = {t: TARGETS[t][4] for t in TARGETS if TARGETS[t][4]}
+
+    for item in args.cpi:
+        t, v = item.split("=")
+        cpis[t] = float(v)
+
+    # SysTick counts to instructions
+    insn_per_cnt = (1e9 / args.sysclk) / (1 << args.shift)
+    if (1 << args.shift) < (1e9 / args.sysclk):
+        sys.stderr.write("xpt2046_bench: shift %d too small, SysTick misses instructions\n" % args.shift)
+
+    results = {}
+
+    for target in targets:
+        scale = 1.0 if TARGETS[target][3] is None else insn_per_cnt
+
+        for name in names:
+            if name not in profs:
+                sys.stderr.write("xpt2046_bench: unknown profile %s\n" % name)
+                return 1
+            try:
+                exe = build(target, name, gen_cfg(template, profs[name]), args.dir, args.cycles)
+                results["%s/%s" % (target, name)] = parse(run(target, exe, args.shift), scale)
+            except (OSError, subprocess.SubprocessError, RuntimeError, ValueError) as e:
+                sys.stderr.write("xpt2046_bench: %s/%s failed: %s\n" % (target, name, e))
+                return 1
+
+    report(results, cpis)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+
+    status = 0
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            slower = compare(results, json.load(f), args.regression)
+        for line in slower:
+            sys.stderr.write("xpt2046_bench: regression %s\n" % line)
+        status = 1 if slower else 0
+
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_bench_cm.c
+*@brief     Cortex-M target of touch pipeline benchmark
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Bare metal Cortex-M target: vector table, reset, semihosting output
+* 	and counter. Linked with xpt2046_bench.ld for QEMU MPS2 boards
+* 	(mps2-an386 Cortex-M4, mps2-an500 Cortex-M7).
+*
+* 	Counter:
+*
+* 		- default:	SysTick under QEMU with "-icount shift=N". QEMU does
+* 					not model DWT, but with icount each instruction takes
+* 					2^N ns of virtual time, thus SysTick (25 MHz) counts
+* 					instructions. Script converts counts to instructions.
+*
+* 		- XPT2046_BENCH_CNT_DWT: DWT cycle counter, for board or
+* 					simulator modelling DWT. Counts are core cycles.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <string.h>
+
+#include "xpt2046_bench.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// System control registers
+#define XPT2046_BENCH_REG(addr)			( *(volatile uint32_t*)( addr ))
+#define XPT2046_BENCH_SYST_CSR			XPT2046_BENCH_REG( 0xE000E010U )
+#define XPT2046_BENCH_SYST_RVR			XPT2046_BENCH_REG( 0xE000E014U )
+#define XPT2046_BENCH_SYST_CVR			XPT2046_BENCH_REG( 0xE000E018U )
+#define XPT2046_BENCH_CPACR				XPT2046_BENCH_REG( 0xE000ED88U )
+#define XPT2046_BENCH_DEMCR				XPT2046_BENCH_REG( 0xE000EDFCU )
+#define XPT2046_BENCH_DWT_CTRL			XPT2046_BENCH_REG( 0xE0001000U )
+#define XPT2046_BENCH_DWT_CYCCNT		XPT2046_BENCH_REG( 0xE0001004U )
+
+// SysTick is 24-bit down counter
+#define XPT2046_BENCH_SYST_MAX			( 0x00FFFFFFU )
+
+// Semihosting operations
+#define XPT2046_BENCH_SH_WRITE0			( 0x04U )
+#define XPT2046_BENCH_SH_EXIT			( 0x18U )
+#define XPT2046_BENCH_SH_APP_EXIT		( 0x20026U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// Linker symbols
+extern uint32_t _estack;
+extern uint32_t _sbss;
+extern uint32_t _ebss;
+
+// Extended SysTick count
+static uint32_t g_cnt_last = 0;
+static uint32_t g_cnt_high = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+void			xpt2046_bench_reset		(void);
+static void		xpt2046_bench_fault		(void);
+static uint32_t	xpt2046_bench_semihost	(const uint32_t op, const void * const p_arg);
+
+extern int main(void);
+
+// Vector table: stack, reset and core exceptions
+__attribute__(( section( ".vectors" ), used ))
+static const void * const gc_vectors[16] =
+{
+	&_estack,
+	(void*) xpt2046_bench_reset,
+	(void*) xpt2046_bench_fault,
+	(void*) xpt2046_bench_fault,
+	(void*) xpt2046_bench_fault,
+	(void*) xpt2046_bench_fault,
+	(void*) xpt2046_bench_fault,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset handler
+*
+* @note		Data is loaded in place by emulator (LMA == VMA), only BSS
+* 			is cleared.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_reset(void)
+{
+	memset( &_sbss, 0, (uint32_t)((uint8_t*) &_ebss - (uint8_t*) &_sbss ));
+
+	// Enable FPU
+	#if defined( __ARM_FP )
+		XPT2046_BENCH_CPACR |= ( 0xFU << 20 );
+		__asm volatile ( "dsb\n isb" );
+	#endif
+
+	#if defined( XPT2046_BENCH_CNT_DWT )
+		XPT2046_BENCH_DEMCR |= ( 1U << 24 );
+		XPT2046_BENCH_DWT_CYCCNT = 0;
+		XPT2046_BENCH_DWT_CTRL |= 1U;
+	#else
+		// Free running from core clock, no interrupt
+		XPT2046_BENCH_SYST_RVR = XPT2046_BENCH_SYST_MAX;
+		XPT2046_BENCH_SYST_CVR = 0;
+		XPT2046_BENCH_SYST_CSR = 0x05U;
+	#endif
+
+	xpt2046_bench_exit((int32_t) main());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get counter
+*
+* @note		SysTick is extended to 32 bits, thus it must be read at
+* 			least once per SysTick period.
+*
+* @return 		cnt - Counts
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_bench_cnt(void)
+{
+	#if defined( XPT2046_BENCH_CNT_DWT )
+		return XPT2046_BENCH_DWT_CYCCNT;
+	#else
+		const uint32_t now = XPT2046_BENCH_SYST_MAX - ( XPT2046_BENCH_SYST_CVR & XPT2046_BENCH_SYST_MAX );
+
+		if ( now < ( g_cnt_last & XPT2046_BENCH_SYST_MAX ))
+		{
+			g_cnt_high += ( XPT2046_BENCH_SYST_MAX + 1U );
+		}
+
+		g_cnt_last = g_cnt_high | now;
+
+		return g_cnt_last;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write string to host
+*
+* @param[in]	p_str	- Null terminated string
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_write(const char * const p_str)
+{
+	(void) xpt2046_bench_semihost( XPT2046_BENCH_SH_WRITE0, p_str );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stop emulation
+*
+* @param[in]	code	- Exit code, 0 on success
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_exit(const int32_t code)
+{
+	// 32-bit semihosting can not pass exit code, report failure as text
+	if ( 0 != code )
+	{
+		xpt2046_bench_write( "BENCH FAIL\n" );
+	}
+
+	(void) xpt2046_bench_semihost( XPT2046_BENCH_SH_EXIT, (const void*) XPT2046_BENCH_SH_APP_EXIT );
+
+	for (;;)
+	{
+		// No actions...
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fault handler
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046_bench_fault(void)
+{
+	xpt2046_bench_exit( 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Semihosting call
+*
+* @param[in]	op		- Operation
+* @param[in]	p_arg	- Argument
+* @return 		result	- Result of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t xpt2046_bench_semihost(const uint32_t op, const void * const p_arg)
+{
+	register uint32_t r0 __asm( "r0" ) = op;
+	register const void * r1 __asm( "r1" ) = p_arg;
+
+	__asm volatile ( "bkpt 0xAB" : "+r" ( r0 ) : "r" ( r1 ) : "memory" );
+
+	return r0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_bench_host.c
+*@brief     Host target of touch pipeline benchmark
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host (POSIX) target, counts are nanoseconds. Used to check benchmark
+* 	itself and profiles without cross toolchain, numbers do not reflect
+* 	target.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "xpt2046_bench.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get counter
+*
+* @return 		cnt - Time in ns (wraps)
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_bench_cnt(void)
+{
+	struct timespec ts;
+
+	(void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return (uint32_t)((uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write string
+*
+* @param[in]	p_str	- Null terminated string
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_write(const char * const p_str)
+{
+	(void) fputs( p_str, stdout );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Exit benchmark
+*
+* @param[in]	code	- Exit code, 0 on success
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_bench_exit(const int32_t code)
+{
+	(void) fflush( stdout );
+	exit((int) code );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,55 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_if.h
+*@brief     Interface with simulated XPT2046 for benchmark
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_IF
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Interface with simulated XPT2046 chip, implemented in
+* 	tools/bench/xpt2046_bench.c. Copied as "xpt2046_if.h" by benchmark
+* 	build script.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_IF_H_
+#define _XPT2046_IF_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "xpt2046/src/xpt2046.h"
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Interface backend marker (benchmark)
+#define XPT2046_IF_BENCH
+
+// Chip select actions
+typedef enum
+{
+	eSPI_CS_NONE			= 0x00,
+	eSPI_CS_LOW_ON_ENTRY	= 0x01,
+	eSPI_CS_HIGH_ON_EXIT	= 0x02,
+} spi_cs_action_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t	xpt2046_if_init					(void);
+xpt2046_status_t 	xpt2046_if_spi_transmit_receive	(const uint8_t * p_tx, uint8_t * const p_rx, const uint32_t size, const spi_cs_action_t cs_action);
+bool				xpt2046_if_get_int				(void);
+xpt2046_status_t	xpt2046_if_spi_set_clk			(const uint8_t idx);
+
+#endif // _XPT2046_IF_H_
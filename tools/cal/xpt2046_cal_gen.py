@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+#
+#  @file      xpt2046_cal_gen.py
+#  @brief     Factory calibration header generator for XPT2046
+#  @author    Ziga Miklosic
+#  @date      18.10.2026
+#  @version   V1.1.0
+#
+################################################################################
+"""
+Generate xpt2046_cal_baked.h with factory calibration factors.
+
+Factors are taken either from a text file with 7 integers, as returned
+by xpt2046_get_cal_factors() or used by xpt2046d (-k), or calculated
+from three display/touch point pairs measured on the fixture.
+
+Usage:
+    xpt2046_cal_gen.py -f cal_factors.txt -o xpt2046_cal_baked.h
+    xpt2046_cal_gen.py -p 48,32,500,400 -p 240,288,2000,3000 -p 432,160,3500,1800
+
+Point format is Dx,Dy,Tx,Ty (display pixel, raw touch ADC value).
+"""
+
+import argparse
+import sys
+
+# Number of calibration factors
+CAL_FACTORS_NUM = 7
+
+# Fixed point format used by driver
+CAL_Q = 16
+
+# Max. raw ADC value (12-bit)
+RAW_MAX = 4095
+
+INT32_MAX = 2147483647
+
+
+def calc_factors(points):
+    """ Calculate factors from 3 (Dx, Dy, Tx, Ty) points, same as driver """
+    (dx0, dy0, tx0, ty0), (dx1, dy1, tx1, ty1), (dx2, dy2, tx2, ty2) = points
+
+    return [
+        (tx0 - tx2) * (ty1 - ty2) - (tx1 - tx2) * (ty0 - ty2),
+        (dx0 - dx2) * (ty1 - ty2) - (dx1 - dx2) * (ty0 - ty2),
+        (tx0 - tx2) * (dx1 - dx2) - (dx0 - dx2) * (tx1 - tx2),
+        ty0 * (tx2 * dx1 - tx1 * dx2) + ty1 * (tx0 * dx2 - tx2 * dx0) + ty2 * (tx1 * dx0 - tx0 * dx1),
+        (dy0 - dy2) * (ty1 - ty2) - (dy1 - dy2) * (ty0 - ty2),
+        (tx0 - tx2) * (dy1 - dy2) - (dy0 - dy2) * (tx1 - tx2),
+        ty0 * (tx2 * dy1 - tx1 * dy2) + ty1 * (tx0 * dy2 - tx2 * dy0) + ty2 * (tx1 * dy0 - tx0 * dy1),
+    ]
+
+
+def q16(f, f0):
+    """ Q16 factor rounded to nearest, same as driver """
+    n = abs(f) * (1 << CAL_Q) + abs(f0) // 2
+    q = n // abs(f0)
+    return q if (f < 0) == (f0 < 0) else -q
+
+
+def check_factors(factors):
+    """ Validate factors against driver fixed point range """
+    f0 = factors[0]
+
+    if 0 == f0:
+        raise ValueError("divisor (factor 0) is zero, calibration points are collinear")
+
+    for f in factors:
+        if not (-INT32_MAX - 1) <= f <= INT32_MAX:
+            raise ValueError("factor %d does not fit into int32" % f)
+
+    for axis, (kx, ky, k0) in (("X", factors[1:4]), ("Y", factors[4:7])):
+        acc = (abs(q16(kx, f0)) + abs(q16(ky, f0))) * RAW_MAX + abs(q16(k0, f0) + (1 << (CAL_Q - 1)))
+        if acc > INT32_MAX:
+            raise ValueError("%s factors out of Q%d fixed point range" % (axis, CAL_Q))
+
+
+def gen_header(factors, source):
+    lines = [
+        "// Generated by tools/cal/xpt2046_cal_gen.py, do not edit!",
+        "// Source: %s" % source,
+        "//",
+        "// Factory calibration factors for XPT2046 (see XPT2046_CAL_BAKED_EN)",
+        "//",
+        "// \tDx = ( F1 * Tx + F2 * Ty + F3 ) / F0",
+        "// \tDy = ( F4 * Tx + F5 * Ty + F6 ) / F0",
+        "",
+        "#ifndef _XPT2046_CAL_BAKED_H_",
+        "#define _XPT2046_CAL_BAKED_H_",
+        "",
+    ]
+
+    for i, f in enumerate(factors):
+        lines.append("#define XPT2046_CAL_BAKED_F%d\t\t\t\t( %dLL )" % (i, f))
+
+    lines += [
+        "",
+        "#endif // _XPT2046_CAL_BAKED_H_",
+        "",
+    ]
+
+    return "\n".join(lines)
+
+
+def parse_point(text):
+    vals = [int(v, 0) for v in text.split(",")]
+    if 4 != len(vals):
+        raise argparse.ArgumentTypeError("point must be Dx,Dy,Tx,Ty")
+    return vals
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate XPT2046 factory calibration header")
+    src = parser.add_mutually_exclusive_group(required=True)
+    src.add_argument("-f", "--factors", help="text file with 7 calibration factors")
+    src.add_argument("-p", "--point", type=parse_point, action="append", help="Dx,Dy,Tx,Ty (give 3 times)")
+    parser.add_argument("-o", "--output", help="output header (default: stdout)")
+    args = parser.parse_args()
+
+    try:
+        if args.factors:
+            with open(args.factors) as f:
+                factors = [int(v, 0) for v in f.read().split()]
+            if CAL_FACTORS_NUM != len(factors):
+                raise ValueError("expected %d factors, got %d" % (CAL_FACTORS_NUM, len(factors)))
+            source = args.factors
+        else:
+            if 3 != len(args.point):
+                raise ValueError("expected 3 points, got %d" % len(args.point))
+            factors = calc_factors(args.point)
+            source = " ".join(",".join(str(v) for v in p) for p in args.point)
+
+        check_factors(factors)
+
+    except (OSError, ValueError) as e:
+        sys.stderr.write("xpt2046_cal_gen: %s\n" % e)
+        return 1
+
+    header = gen_header(factors, source)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(header)
+    else:
+        sys.stdout.write(header)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,570 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046d.c
+*@brief     XPT2046 Linux userspace touch daemon
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_DAEMON
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Linux userspace touch daemon.
+*
+* 	Runs touch pipeline of this library (filtering, calibration, pen
+* 	state) and publishes events in evdev input_event format either to
+* 	uinput device (default) or to file/pipe ("-" for stdout).
+*
+* 	With Linux interface backend (template/xpt2046_if_linux) daemon
+* 	sleeps in epoll() until PENIRQ edge, then runs touch handler from
+* 	periodic timerfd until touch is released and PENIRQ deasserted.
+*
+* 	With virtual device backend (template/xpt2046_if_vdev) handler runs
+* 	in virtual time as fast as possible and daemon exits when virtual
+* 	device server disconnects. Intended for tests.
+*
+* 	Build (from directory containing xpt2046/, xpt2046_cfg.h and xpt2046_if.c/.h):
+*
+* 		gcc -std=gnu99 -O2 -I. -Ixpt2046/src -o xpt2046d \
+* 			xpt2046/src/xpt2046*.c xpt2046_if.c xpt2046/tools/linux/xpt2046d.c
+*
+* 	Usage:	xpt2046d [-o uinput|<path>|-] [-k cal_factors.txt] [-P params.bin]
+*
+* 	Calibration factors file contains 7 integers as returned by
+* 	calibration. Parameter blob is produced by xpt2046_par_serialize().
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/input.h>
+#include <linux/uinput.h>
+
+#include "xpt2046.h"
+#include "xpt2046_evt.h"
+#include "xpt2046_par.h"
+#include "xpt2046_pressure.h"
+#include "xpt2046_cfg.h"
+#include "xpt2046_if.h"
+
+#if defined( XPT2046_IF_LINUX )
+	#include <sys/epoll.h>
+	#include <sys/signalfd.h>
+	#include <sys/timerfd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 != XPT2046_EVT_EN )
+	#error "xpt2046d requires XPT2046_EVT_EN!"
+#endif
+
+#if !defined( XPT2046_IF_LINUX ) && !defined( XPT2046_IF_VDEV )
+	#error "xpt2046d requires Linux or virtual device interface backend!"
+#endif
+
+// Pressure range
+#if ( 1 == XPT2046_PRESSURE_EN )
+	#define XPT2046D_PRESSURE_MAX			( XPT2046_PRESSURE_MAX )
+#else
+	#define XPT2046D_PRESSURE_MAX			( UINT16_MAX )
+#endif
+
+// Number of calibration factors
+#define XPT2046D_CAL_FACTORS_NUM			( 7 )
+
+// Output
+typedef struct
+{
+	int		fd;
+	bool	uinput;
+} xpt2046d_out_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+static xpt2046d_out_t g_out = { .fd = -1 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static int	xpt2046d_out_open	(const char * const p_out);
+static void	xpt2046d_out_close	(void);
+static void	xpt2046d_emit		(const uint32_t timestamp, const uint16_t type, const uint16_t code, const int32_t value);
+static void	xpt2046d_publish	(void);
+static int	xpt2046d_load_cal	(const char * const p_file);
+static int	xpt2046d_load_par	(const char * const p_file);
+static int	xpt2046d_run		(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Daemon entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	const char * p_out = "uinput";
+	const char * p_cal = NULL;
+	const char * p_par = NULL;
+	int opt;
+	int ret = 0;
+
+	while ( -1 != ( opt = getopt( argc, argv, "o:k:P:" )))
+	{
+		switch( opt )
+		{
+			case 'o':
+				p_out = optarg;
+				break;
+
+			case 'k':
+				p_cal = optarg;
+				break;
+
+			case 'P':
+				p_par = optarg;
+				break;
+
+			default:
+				fprintf( stderr, "usage: %s [-o uinput|<path>|-] [-k cal_factors.txt] [-P params.bin]\n", argv[0] );
+				return 1;
+		}
+	}
+
+	if ( eXPT2046_OK != xpt2046_init())
+	{
+		fprintf( stderr, "xpt2046d: touch controller init failed\n" );
+		ret = 1;
+	}
+
+	if (( 0 == ret ) && ( NULL != p_par ))
+	{
+		ret = xpt2046d_load_par( p_par );
+
+		// Apply parameters before output range is set up
+		xpt2046_par_apply();
+	}
+
+	if (( 0 == ret ) && ( NULL != p_cal ))
+	{
+		ret = xpt2046d_load_cal( p_cal );
+	}
+
+	if ( 0 == ret )
+	{
+		ret = xpt2046d_out_open( p_out );
+	}
+
+	if ( 0 == ret )
+	{
+		ret = xpt2046d_run();
+	}
+
+	xpt2046d_out_close();
+
+	return ret;
+}
+
+#if defined( XPT2046_IF_LINUX )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Daemon main loop (PENIRQ driven)
+*
+* @return 		ret - Exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int xpt2046d_run(void)
+{
+	const int irq_fd = xpt2046_if_linux_get_irq_fd();
+	struct itimerspec period;
+	struct itimerspec stop;
+	struct epoll_event ev;
+	struct epoll_event evs[3];
+	sigset_t mask;
+	uint64_t exp;
+	uint16_t x, y, force;
+	bool pressed;
+	bool active = false;
+	bool run = true;
+	int ep_fd, tmr_fd, sig_fd;
+	int n, i;
+
+	memset( &period, 0, sizeof( period ));
+	memset( &stop, 0, sizeof( stop ));
+	period.it_interval.tv_nsec 	= XPT2046_HNDL_PERIOD_MS * 1000000L;
+	period.it_value.tv_nsec 	= XPT2046_HNDL_PERIOD_MS * 1000000L;
+
+	sigemptyset( &mask );
+	sigaddset( &mask, SIGINT );
+	sigaddset( &mask, SIGTERM );
+	(void) sigprocmask( SIG_BLOCK, &mask, NULL );
+
+	ep_fd 	= epoll_create1( EPOLL_CLOEXEC );
+	tmr_fd 	= timerfd_create( CLOCK_MONOTONIC, TFD_CLOEXEC );
+	sig_fd 	= signalfd( -1, &mask, SFD_CLOEXEC );
+
+	if (( ep_fd < 0 ) || ( tmr_fd < 0 ) || ( sig_fd < 0 ))
+	{
+		perror( "xpt2046d" );
+		return 1;
+	}
+
+	ev.events = EPOLLIN;
+	ev.data.fd = irq_fd;
+	(void) epoll_ctl( ep_fd, EPOLL_CTL_ADD, irq_fd, &ev );
+	ev.data.fd = tmr_fd;
+	(void) epoll_ctl( ep_fd, EPOLL_CTL_ADD, tmr_fd, &ev );
+	ev.data.fd = sig_fd;
+	(void) epoll_ctl( ep_fd, EPOLL_CTL_ADD, sig_fd, &ev );
+
+	// Touch might already be present at start
+	if ( true == xpt2046_if_get_int())
+	{
+		active = true;
+		(void) timerfd_settime( tmr_fd, 0, &period, NULL );
+	}
+
+	while ( true == run )
+	{
+		n = epoll_wait( ep_fd, evs, 3, -1 );
+
+		for ( i = 0; i < n; i++ )
+		{
+			if ( sig_fd == evs[i].data.fd )
+			{
+				run = false;
+			}
+
+			// Touch detected, start periodic handling
+			else if ( irq_fd == evs[i].data.fd )
+			{
+				xpt2046_if_linux_irq_ack();
+
+				if ( false == active )
+				{
+					active = true;
+					(void) timerfd_settime( tmr_fd, 0, &period, NULL );
+				}
+			}
+
+			// Handler period
+			else
+			{
+				(void) read( tmr_fd, &exp, sizeof( exp ));
+
+				xpt2046_hndl();
+
+				// PENIRQ toggles during conversions
+				xpt2046_if_linux_irq_ack();
+
+				xpt2046d_publish();
+
+				(void) xpt2046_get_touch( &x, &y, &force, &pressed );
+
+				// Released, back to sleep until next PENIRQ
+				if 	(	( false == pressed )
+					&&	( false == xpt2046_if_get_int()))
+				{
+					active = false;
+					(void) timerfd_settime( tmr_fd, 0, &stop, NULL );
+				}
+			}
+		}
+	}
+
+	(void) close( sig_fd );
+	(void) close( tmr_fd );
+	(void) close( ep_fd );
+
+	return 0;
+}
+
+#else
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Daemon main loop (virtual time)
+*
+* @return 		ret - Exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int xpt2046d_run(void)
+{
+	do
+	{
+		xpt2046_hndl();
+		xpt2046d_publish();
+	}
+	while ( eXPT2046_OK == xpt2046_if_vdev_advance( XPT2046_HNDL_PERIOD_MS ));
+
+	return 0;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Publish pending touch events
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046d_publish(void)
+{
+	xpt2046_evt_t evt;
+
+	while ( eXPT2046_OK == xpt2046_evt_get( &evt ))
+	{
+		switch( evt.type )
+		{
+			case eXPT2046_EVT_DOWN:
+				xpt2046d_emit( evt.timestamp, EV_KEY, BTN_TOUCH, 1 );
+				xpt2046d_emit( evt.timestamp, EV_ABS, ABS_X, evt.x );
+				xpt2046d_emit( evt.timestamp, EV_ABS, ABS_Y, evt.y );
+				xpt2046d_emit( evt.timestamp, EV_ABS, ABS_PRESSURE, evt.pressure );
+				break;
+
+			case eXPT2046_EVT_MOVE:
+				xpt2046d_emit( evt.timestamp, EV_ABS, ABS_X, evt.x );
+				xpt2046d_emit( evt.timestamp, EV_ABS, ABS_Y, evt.y );
+				xpt2046d_emit( evt.timestamp, EV_ABS, ABS_PRESSURE, evt.pressure );
+				break;
+
+			case eXPT2046_EVT_UP:
+			default:
+				xpt2046d_emit( evt.timestamp, EV_KEY, BTN_TOUCH, 0 );
+				xpt2046d_emit( evt.timestamp, EV_ABS, ABS_PRESSURE, 0 );
+				break;
+		}
+
+		xpt2046d_emit( evt.timestamp, EV_SYN, SYN_REPORT, 0 );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write single input event
+*
+* @note		Timestamp is replaced by kernel when writing to uinput.
+*
+* @param[in]	timestamp	- Event time [ms]
+* @param[in]	type		- Event type
+* @param[in]	code		- Event code
+* @param[in]	value		- Event value
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046d_emit(const uint32_t timestamp, const uint16_t type, const uint16_t code, const int32_t value)
+{
+	struct input_event ie;
+
+	memset( &ie, 0, sizeof( ie ));
+	ie.input_event_sec 	= timestamp / 1000U;
+	ie.input_event_usec = ( timestamp % 1000U ) * 1000U;
+	ie.type 			= type;
+	ie.code 			= code;
+	ie.value 			= value;
+
+	if ( sizeof( ie ) != write( g_out.fd, &ie, sizeof( ie )))
+	{
+		perror( "xpt2046d: output" );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Open event output
+*
+* @param[in]	p_out	- "uinput", "-" for stdout or file/pipe path
+* @return 		ret		- Exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int xpt2046d_out_open(const char * const p_out)
+{
+	struct uinput_setup setup;
+	struct uinput_abs_setup abs;
+	int ret = 0;
+
+	if ( 0 == strcmp( p_out, "-" ))
+	{
+		g_out.fd = STDOUT_FILENO;
+	}
+	else if ( 0 == strcmp( p_out, "uinput" ))
+	{
+		g_out.uinput = true;
+		g_out.fd = open( "/dev/uinput", O_WRONLY | O_CLOEXEC );
+
+		if ( g_out.fd >= 0 )
+		{
+			(void) ioctl( g_out.fd, UI_SET_EVBIT, EV_SYN );
+			(void) ioctl( g_out.fd, UI_SET_EVBIT, EV_KEY );
+			(void) ioctl( g_out.fd, UI_SET_EVBIT, EV_ABS );
+			(void) ioctl( g_out.fd, UI_SET_KEYBIT, BTN_TOUCH );
+			(void) ioctl( g_out.fd, UI_SET_ABSBIT, ABS_X );
+			(void) ioctl( g_out.fd, UI_SET_ABSBIT, ABS_Y );
+			(void) ioctl( g_out.fd, UI_SET_ABSBIT, ABS_PRESSURE );
+			(void) ioctl( g_out.fd, UI_SET_PROPBIT, INPUT_PROP_DIRECT );
+
+			memset( &abs, 0, sizeof( abs ));
+			abs.code = ABS_X;
+			abs.absinfo.maximum = xpt2046_par_get_value( eXPT2046_PAR_DISPLAY_MAX_X );
+			(void) ioctl( g_out.fd, UI_ABS_SETUP, &abs );
+			abs.code = ABS_Y;
+			abs.absinfo.maximum = xpt2046_par_get_value( eXPT2046_PAR_DISPLAY_MAX_Y );
+			(void) ioctl( g_out.fd, UI_ABS_SETUP, &abs );
+			abs.code = ABS_PRESSURE;
+			abs.absinfo.maximum = XPT2046D_PRESSURE_MAX;
+			(void) ioctl( g_out.fd, UI_ABS_SETUP, &abs );
+
+			memset( &setup, 0, sizeof( setup ));
+			setup.id.bustype = BUS_SPI;
+			strncpy( setup.name, "XPT2046 Touchscreen", UINPUT_MAX_NAME_SIZE - 1 );
+
+			if 	(	( ioctl( g_out.fd, UI_DEV_SETUP, &setup ) < 0 )
+				||	( ioctl( g_out.fd, UI_DEV_CREATE ) < 0 ))
+			{
+				ret = 1;
+			}
+		}
+	}
+	else
+	{
+		g_out.fd = open( p_out, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+	}
+
+	if (( g_out.fd < 0 ) || ( 0 != ret ))
+	{
+		perror( p_out );
+		ret = 1;
+	}
+
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Close event output
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void xpt2046d_out_close(void)
+{
+	if ( g_out.fd >= 0 )
+	{
+		if ( true == g_out.uinput )
+		{
+			(void) ioctl( g_out.fd, UI_DEV_DESTROY );
+		}
+
+		if ( STDOUT_FILENO != g_out.fd )
+		{
+			(void) close( g_out.fd );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load calibration factors
+*
+* @param[in]	p_file	- Text file with calibration factors
+* @return 		ret		- Exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int xpt2046d_load_cal(const char * const p_file)
+{
+	int32_t factors[ XPT2046D_CAL_FACTORS_NUM ];
+	FILE * p_f = fopen( p_file, "r" );
+	int ret = 1;
+	int i = 0;
+
+	if ( NULL != p_f )
+	{
+		while 	(	( i < XPT2046D_CAL_FACTORS_NUM )
+				&&	( 1 == fscanf( p_f, "%" SCNd32, &factors[i] )))
+		{
+			i++;
+		}
+
+		(void) fclose( p_f );
+
+		if 	(	( XPT2046D_CAL_FACTORS_NUM == i )
+			&&	( 0 != factors[0] ))
+		{
+			xpt2046_set_cal_factors( factors );
+			ret = 0;
+		}
+	}
+
+	if ( 0 != ret )
+	{
+		fprintf( stderr, "xpt2046d: invalid calibration file %s\n", p_file );
+	}
+
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load parameter blob
+*
+* @param[in]	p_file	- Binary file with serialized parameters
+* @return 		ret		- Exit code
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int xpt2046d_load_par(const char * const p_file)
+{
+	uint8_t blob[ XPT2046_PAR_BLOB_SIZE ];
+	FILE * p_f = fopen( p_file, "rb" );
+	size_t len = 0;
+	int ret = 1;
+
+	if ( NULL != p_f )
+	{
+		len = fread( blob, 1, sizeof( blob ), p_f );
+		(void) fclose( p_f );
+
+		if ( eXPT2046_OK == xpt2046_par_deserialize( blob, (uint32_t) len ))
+		{
+			ret = 0;
+		}
+	}
+
+	if ( 0 != ret )
+	{
+		fprintf( stderr, "xpt2046d: invalid parameter file %s\n", p_file );
+	}
+
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
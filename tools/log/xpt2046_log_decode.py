@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+#
+#  @file      xpt2046_log_decode.py
+#  @brief     Deferred binary log decoder for XPT2046
+#  @author    Ziga Miklosic
+#  @date      18.10.2026
+#  @version   V1.1.0
+#
+################################################################################
+"""
+Decode binary log records produced by xpt2046_log_read() into text.
+
+Message format strings are taken from XPT2046_LOG_TABLE in
+src/xpt2046_log.h, thus decoder always matches the library it comes
+with. Input is decoded as a stream, garbage between records (e.g. other
+traffic on the same port) is skipped.
+
+Usage:
+    xpt2046_log_decode.py log.bin
+    cat /dev/ttyUSB0 | xpt2046_log_decode.py -
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# Record layout, see xpt2046_log.h
+LOG_SYNC = 0xA5
+LOG_REC_SIZE = 16
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "src", "xpt2046_log.h")
+
+# Log table entry: X( eXPT2046_LOG_NAME, "format" )
+TABLE_ENTRY_RE = re.compile(r'X\(\s*(eXPT2046_LOG_\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+
+# printf conversion with optional flags, width, precision and length
+CONV_RE = re.compile(r'%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l)?([diuxXc%])')
+
+
+def load_table(path):
+    """ Read message names and formats from log header """
+    with open(path) as f:
+        text = f.read()
+
+    start = text.index("#define XPT2046_LOG_TABLE")
+    table = TABLE_ENTRY_RE.findall(text[start:])
+
+    return [(name, bytes(fmt, "utf-8").decode("unicode_escape")) for name, fmt in table]
+
+
+def format_msg(fmt, args):
+    """ Apply C printf format to 32-bit arguments """
+    args = list(args)
+
+    def conv(m):
+        flags, c = m.group(1), m.group(2)
+        if "%" == c:
+            return "%"
+        val = args.pop(0) if args else 0
+        if c in "di":
+            val = val - (1 << 32) if val & 0x80000000 else val
+            c = "d"
+        elif "u" == c:
+            c = "d"
+        elif "c" == c:
+            val = chr(val & 0xFF)
+        return ("%" + flags + c) % val
+
+    return CONV_RE.sub(conv, fmt)
+
+
+def parse_record(rec):
+    """ Return (id, timestamp, a0, a1) or None if not valid record """
+    if rec[0] != LOG_SYNC or rec[2] != (~rec[1] & 0xFF):
+        return None
+
+    chk = 0
+    for b in rec[4:]:
+        chk ^= b
+
+    if chk != rec[3]:
+        return None
+
+    ts, a0, a1 = struct.unpack_from("<III", rec, 4)
+
+    return rec[1], ts, a0, a1
+
+
+def decode_stream(stream, table, out):
+    """ Decode records from binary stream """
+    buf = bytearray()
+    skipped = 0
+
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+
+        while len(buf) >= LOG_REC_SIZE:
+            rec = parse_record(buf[:LOG_REC_SIZE])
+
+            if rec is None:
+                # Resync on next sync byte
+                nxt = buf.find(bytes([LOG_SYNC]), 1)
+                drop = nxt if nxt > 0 else len(buf)
+                skipped += drop
+                del buf[:drop]
+                continue
+
+            msg_id, ts, a0, a1 = rec
+            del buf[:LOG_REC_SIZE]
+
+            if msg_id < len(table):
+                name, fmt = table[msg_id]
+                text = format_msg(fmt, (a0, a1))
+            else:
+                name = "UNKNOWN_%d" % msg_id
+                text = "args 0x%08X 0x%08X" % (a0, a1)
+
+            out.write("[%10u ms] %-28s %s\n" % (ts, name, text))
+
+    if skipped:
+        sys.stderr.write("xpt2046_log_decode: skipped %d bytes\n" % skipped)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode XPT2046 binary log")
+    parser.add_argument("input", help="binary log file or - for stdin")
+    parser.add_argument("-H", "--header", default=DEFAULT_HEADER, help="path to xpt2046_log.h")
+    args = parser.parse_args()
+
+    try:
+        table = load_table(args.header)
+    except (OSError, ValueError) as e:
+        sys.stderr.write("xpt2046_log_decode: can not read log table: %s\n" % e)
+        return 1
+
+    if "-" == args.input:
+        decode_stream(sys.stdin.buffer, table, sys.stdout)
+    else:
+        with open(args.input, "rb") as f:
+            decode_stream(f, table, sys.stdout)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
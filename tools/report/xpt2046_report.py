@@ -0,0 +1,649 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+#
+#  @file      xpt2046_report.py
+#  @brief     Touch trace report generator for XPT2046
+#  @author    Ziga Miklosic
+#  @date      18.10.2026
+#  @version   V1.1.0
+#
+################################################################################
+"""
+Generate self-contained HTML (or SVG) report from touch traces and pipeline
+output, for tuning filters on recorded traces:
+
+    - overlaid raw, filtered and output paths
+    - x, y and pressure over time with touch down/up markers
+    - jitter statistics (second difference of position within stroke),
+      sample interval and down/up latency of each series against raw trace
+
+Inputs, any combination:
+    -r trace.csv     raw input, virtual device trace (time_ms,pressed,x,y,rt)
+    -f filt.csv      filtered samples, CSV with header (time_ms,pressed,x,y[,pressure])
+    -e events.bin    pipeline output, evdev input_event file of xpt2046d (-o)
+    -s stream.bin    pipeline output, touch event stream (XPT2046_STREAM_EN)
+
+Raw and filtered samples are in ADC units. With calibration factors (-k, same
+file as xpt2046d) they are mapped to display coordinates and drawn over
+output path, otherwise they get own path plot.
+
+All inputs are read in streaming fashion and merged by time. Paths and time
+series are kept in fixed size buffers which halve their resolution when
+full (min/max of each bucket is kept, thus spikes stay visible), statistics
+are running sums, so memory does not depend on trace length.
+
+Usage:
+    xpt2046_report.py -r trace.csv -e events.bin -k cal_factors.txt -o report.html
+    xpt2046_report.py -r trace.csv -f filt.csv -o report.svg
+"""
+
+import argparse
+import csv
+import heapq
+import html
+import math
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "stream"))
+
+from xpt2046_stream import StreamDecoder, EVT_NAMES  # noqa: E402
+
+# Series, in drawing order
+SERIES = ("raw", "filtered", "output")
+COLORS = {"raw": "#9e9e9e", "filtered": "#1e88e5", "output": "#e53935"}
+MARKER_COLORS = {"DOWN": "#43a047", "UP": "#fb8c00"}
+
+# Number of calibration factors, see xpt2046.c
+CAL_FACTORS_NUM = 7
+
+# evdev input_event on 64-bit Linux: timeval, type, code, value
+EVDEV_FMT = "<qqHHi"
+EVDEV_SIZE = struct.calcsize(EVDEV_FMT)
+EV_SYN, EV_KEY, EV_ABS = 0x00, 0x01, 0x03
+BTN_TOUCH, ABS_X, ABS_Y, ABS_PRESSURE = 0x14A, 0x00, 0x01, 0x18
+
+# Jitter histogram, bins of JITTER_BIN units
+JITTER_BIN = 0.25
+JITTER_BINS = 256
+
+# Read size of binary inputs
+CHUNK_SIZE = 4096
+
+
+class Sample:
+    """ Touch sample of one series, evt is DOWN, MOVE or UP """
+    __slots__ = ("t", "series", "evt", "x", "y", "p")
+
+    def __init__(self, t, series, evt, x, y, p):
+        self.t, self.series, self.evt, self.x, self.y, self.p = t, series, evt, x, y, p
+
+
+################################################################################
+# Readers, generators of samples in time order
+################################################################################
+
+def load_cal(path):
+    """ Return calibration factors from text file """
+    with open(path) as f:
+        factors = [int(v, 0) for v in f.read().split()]
+
+    if CAL_FACTORS_NUM != len(factors) or 0 == factors[0]:
+        raise ValueError("%s: expected %d factors with non-zero divisor" % (path, CAL_FACTORS_NUM))
+
+    return factors
+
+
+def apply_cal(cal, x, y):
+    """ Map raw to display coordinates, same as driver """
+    return ((cal[1] * x + cal[2] * y + cal[3]) / cal[0],
+            (cal[4] * x + cal[5] * y + cal[6]) / cal[0])
+
+
+def read_csv(path, series, cal):
+    """ Raw or filtered CSV trace, header is optional for virtual device trace layout """
+    cols = {"time_ms": 0, "pressed": 1, "x": 2, "y": 3, "rt": 4}
+    pressed_prev = False
+
+    with open(path, newline="") as f:
+        for row in csv.reader(f):
+            if not row or row[0].lstrip().startswith("#"):
+                continue
+
+            if not row[0].strip().replace(".", "", 1).isdigit():
+                cols = {name.strip(): i for i, name in enumerate(row)}
+                if not all(c in cols for c in ("time_ms", "pressed", "x", "y")):
+                    raise ValueError("%s: header needs time_ms, pressed, x and y" % path)
+                continue
+
+            t = float(row[cols["time_ms"]])
+            pressed = 0 != int(row[cols["pressed"]])
+            p_col = cols.get("pressure", cols.get("rt"))
+            p = float(row[p_col]) if p_col is not None and p_col < len(row) else None
+
+            if pressed:
+                x, y = float(row[cols["x"]]), float(row[cols["y"]])
+                if cal:
+                    x, y = apply_cal(cal, x, y)
+                yield Sample(t, series, "MOVE" if pressed_prev else "DOWN", x, y, p)
+            elif pressed_prev:
+                yield Sample(t, series, "UP", None, None, None)
+
+            pressed_prev = pressed
+
+
+def read_chunks(path):
+    with open(path, "rb") as f:
+        while True:
+            chunk = f.read(CHUNK_SIZE)
+            if not chunk:
+                break
+            yield chunk
+
+
+def read_evdev(path, offset):
+    """ evdev input_event file written by xpt2046d """
+    buf = b""
+    x = y = p = 0
+    touch = touch_prev = False
+
+    for chunk in read_chunks(path):
+        buf += chunk
+        num = len(buf) // EVDEV_SIZE
+
+        for sec, usec, typ, code, val in struct.iter_unpack(EVDEV_FMT, buf[:num * EVDEV_SIZE]):
+            if EV_KEY == typ and BTN_TOUCH == code:
+                touch = 0 != val
+            elif EV_ABS == typ:
+                if ABS_X == code:
+                    x = val
+                elif ABS_Y == code:
+                    y = val
+                elif ABS_PRESSURE == code:
+                    p = val
+            elif EV_SYN == typ:
+                t = sec * 1000.0 + usec / 1000.0 + offset
+                if touch:
+                    yield Sample(t, "output", "MOVE" if touch_prev else "DOWN", x, y, p)
+                elif touch_prev:
+                    yield Sample(t, "output", "UP", None, None, None)
+                touch_prev = touch
+
+        buf = buf[num * EVDEV_SIZE:]
+
+
+def read_stream(path, offset):
+    """ Touch event stream of xpt2046_stream_encode() """
+    dec = StreamDecoder()
+
+    for chunk in read_chunks(path):
+        for evt in dec.feed(chunk):
+            name = EVT_NAMES[evt.type]
+            if "UP" == name:
+                yield Sample(evt.timestamp + offset, "output", name, None, None, None)
+            else:
+                yield Sample(evt.timestamp + offset, "output", name, evt.x, evt.y, evt.pressure)
+
+
+################################################################################
+# Bounded accumulators
+################################################################################
+
+class PathBuf:
+    """ Path points, every other point is dropped when full """
+
+    def __init__(self, cap):
+        self.cap = cap
+        self.step = 1
+        self.cnt = 0
+        self.pts = []   # (x, y, stroke)
+
+    def add(self, x, y, stroke, first):
+        if first or 0 == (self.cnt % self.step):
+            self.pts.append((x, y, stroke))
+            if len(self.pts) > self.cap:
+                self.pts = self.pts[::2]
+                self.step *= 2
+        self.cnt += 1
+
+    def strokes(self):
+        """ Return list of strokes as point lists """
+        out = []
+        for x, y, s in self.pts:
+            if not out or out[-1][0] != s:
+                out.append((s, []))
+            out[-1][1].append((x, y))
+        return [pts for _, pts in out]
+
+
+class EnvelopeBuf:
+    """ Time series as buckets of first, min, max, last value, pairs merge when full """
+
+    def __init__(self, cap):
+        self.cap = cap
+        self.width = 1
+        self.buckets = []   # [n, stroke, t0, v0, tmin, vmin, tmax, vmax, t1, v1]
+
+    def add(self, t, v, stroke):
+        b = self.buckets[-1] if self.buckets else None
+
+        if b is None or b[0] >= self.width or b[1] != stroke:
+            self.buckets.append([1, stroke, t, v, t, v, t, v, t, v])
+            if len(self.buckets) > self.cap:
+                self._merge()
+        else:
+            b[0] += 1
+            if v < b[5]:
+                b[4], b[5] = t, v
+            if v > b[7]:
+                b[6], b[7] = t, v
+            b[8], b[9] = t, v
+
+    def _merge(self):
+        """ Merge bucket pairs, pair spanning two strokes belongs to later one """
+        merged = []
+        for m, b in zip(self.buckets[0::2], self.buckets[1::2]):
+            m[0] += b[0]
+            m[1] = b[1]
+            if b[5] < m[5]:
+                m[4], m[5] = b[4], b[5]
+            if b[7] > m[7]:
+                m[6], m[7] = b[6], b[7]
+            m[8], m[9] = b[8], b[9]
+            merged.append(m)
+        if len(self.buckets) % 2:
+            merged.append(self.buckets[-1])
+        self.buckets = merged
+        self.width *= 2
+
+    def strokes(self):
+        """ Return list of strokes as (t, v) lists with extremes in time order """
+        out = []
+        for b in self.buckets:
+            if not out or out[-1][0] != b[1]:
+                out.append((b[1], []))
+            pts = sorted({(b[2], b[3]), (b[4], b[5]), (b[6], b[7]), (b[8], b[9])})
+            out[-1][1].extend(pts)
+        return [pts for _, pts in out]
+
+
+class Markers:
+    """ Touch down/up markers, every other is dropped when full """
+
+    def __init__(self, cap):
+        self.cap = cap
+        self.step = 1
+        self.cnt = 0
+        self.items = []
+
+    def add(self, t, evt):
+        if 0 == (self.cnt % self.step):
+            self.items.append((t, evt))
+            if len(self.items) > self.cap:
+                self.items = self.items[::2]
+                self.step *= 2
+        self.cnt += 1
+
+
+class RunStats:
+    """ Running count, mean, RMS, min and max """
+
+    def __init__(self):
+        self.n = 0
+        self.sum = 0.0
+        self.sum2 = 0.0
+        self.min = math.inf
+        self.max = -math.inf
+
+    def add(self, v):
+        self.n += 1
+        self.sum += v
+        self.sum2 += v * v
+        self.min = min(self.min, v)
+        self.max = max(self.max, v)
+
+    def mean(self):
+        return self.sum / self.n if self.n else math.nan
+
+    def rms(self):
+        return math.sqrt(self.sum2 / self.n) if self.n else math.nan
+
+
+class Hist:
+    """ Histogram for percentiles, bin size doubles when value is out of range """
+
+    def __init__(self, bin_size, bins):
+        self.bin_size = bin_size
+        self.bins = [0] * bins
+        self.n = 0
+
+    def add(self, v):
+        while v >= self.bin_size * len(self.bins):
+            half = len(self.bins) // 2
+            self.bins = [self.bins[2 * i] + self.bins[2 * i + 1] for i in range(half)] + [0] * half
+            self.bin_size *= 2
+        self.bins[int(v / self.bin_size)] += 1
+        self.n += 1
+
+    def percentile(self, pct):
+        """ Upper bound of bin which holds percentile """
+        res = math.nan
+        lim = self.n * pct / 100.0
+        acc = 0
+        for i, cnt in enumerate(self.bins):
+            acc += cnt
+            if self.n and acc >= lim:
+                res = (i + 1) * self.bin_size
+                break
+        return res
+
+
+class SeriesAcc:
+    """ Everything collected for one series """
+
+    def __init__(self, cap):
+        self.path = PathBuf(cap)
+        self.env = {"x": EnvelopeBuf(cap), "y": EnvelopeBuf(cap), "p": EnvelopeBuf(cap)}
+        self.markers = Markers(cap // 4)
+        self.samples = 0
+        self.strokes = 0
+        self.jitter = RunStats()
+        self.jitter_hist = Hist(JITTER_BIN, JITTER_BINS)
+        self.interval = RunStats()
+        self.latency = {"DOWN": RunStats(), "UP": RunStats()}
+        self.unmatched = 0
+        self.prev = []
+        self.t_prev = None
+
+    def add(self, s):
+        if "DOWN" == s.evt:
+            self.strokes += 1
+            self.prev = []
+            self.t_prev = None
+
+        if s.evt in ("DOWN", "UP"):
+            self.markers.add(s.t, s.evt)
+
+        if "UP" == s.evt:
+            return
+
+        self.samples += 1
+        self.path.add(s.x, s.y, self.strokes, "DOWN" == s.evt)
+        self.env["x"].add(s.t, s.x, self.strokes)
+        self.env["y"].add(s.t, s.y, self.strokes)
+        if s.p is not None:
+            self.env["p"].add(s.t, s.p, self.strokes)
+
+        if self.t_prev is not None:
+            self.interval.add(s.t - self.t_prev)
+        self.t_prev = s.t
+
+        # Jitter: magnitude of second difference within stroke
+        self.prev = (self.prev + [(s.x, s.y)])[-3:]
+        if 3 == len(self.prev):
+            (x0, y0), (x1, y1), (x2, y2) = self.prev
+            j = math.hypot(x2 - 2 * x1 + x0, y2 - 2 * y1 + y0)
+            self.jitter.add(j)
+            self.jitter_hist.add(j)
+
+
+def collect(sources, cap):
+    """ Merge sources by time and accumulate, return (series -> accumulator, time range) """
+    acc = {}
+    pending = {"DOWN": None, "UP": None}
+    t_min, t_max = math.inf, -math.inf
+
+    for s in heapq.merge(*sources, key=lambda smp: smp.t):
+        a = acc.get(s.series)
+        if a is None:
+            a = acc[s.series] = SeriesAcc(cap)
+        a.add(s)
+        t_min, t_max = min(t_min, s.t), max(t_max, s.t)
+
+        # Latency of touch down/up against last raw edge
+        if s.evt in pending:
+            if "raw" == s.series:
+                pending[s.evt] = {"t": s.t, "seen": set()}
+            elif pending[s.evt] is not None and s.series not in pending[s.evt]["seen"]:
+                a.latency[s.evt].add(s.t - pending[s.evt]["t"])
+                pending[s.evt]["seen"].add(s.series)
+            else:
+                a.unmatched += 1
+
+    return acc, (t_min, t_max)
+
+
+################################################################################
+# Rendering
+################################################################################
+
+class Scale:
+    """ Linear map of data range to pixels """
+
+    def __init__(self, lo, hi, px_lo, px_hi):
+        if not (hi > lo):
+            lo, hi = lo - 1.0, lo + 1.0
+        self.lo, self.hi, self.px_lo, self.px_hi = lo, hi, px_lo, px_hi
+
+    def __call__(self, v):
+        return self.px_lo + (v - self.lo) * (self.px_hi - self.px_lo) / (self.hi - self.lo)
+
+
+def fmt(v, digits=1):
+    return "-" if v is None or math.isnan(v) or math.isinf(v) else "%.*f" % (digits, v)
+
+
+def polyline(pts, sx, sy, color, width=1.0):
+    if len(pts) < 2:
+        if pts:
+            return '<circle cx="%.1f" cy="%.1f" r="1.5" fill="%s"/>' % (sx(pts[0][0]), sy(pts[0][1]), color)
+        return ""
+    return '<polyline fill="none" stroke="%s" stroke-width="%.1f" points="%s"/>' % (
+        color, width, " ".join("%.1f,%.1f" % (sx(a), sy(b)) for a, b in pts))
+
+
+def svg_panel(width, height, title, body):
+    return ('<svg xmlns="http://www.w3.org/2000/svg" width="%d" height="%d" font-family="sans-serif" font-size="11">'
+            '<rect width="100%%" height="100%%" fill="white"/>'
+            '<text x="8" y="16" font-size="13" font-weight="bold">%s</text>%s</svg>' % (width, height, html.escape(title), body))
+
+
+def legend(names, x, y):
+    out = []
+    for i, name in enumerate(names):
+        out.append('<rect x="%d" y="%d" width="12" height="3" fill="%s"/><text x="%d" y="%d">%s</text>' %
+                   (x + i * 80, y - 4, COLORS[name], x + i * 80 + 16, y, name))
+    return "".join(out)
+
+
+def path_panel(title, acc, names, size=520):
+    """ Overlaid paths, display orientation (y down) """
+    pts = [p for n in names for p in acc[n].path.pts]
+    if not pts:
+        return None
+
+    x_lo, x_hi = min(p[0] for p in pts), max(p[0] for p in pts)
+    y_lo, y_hi = min(p[1] for p in pts), max(p[1] for p in pts)
+    span = max(x_hi - x_lo, y_hi - y_lo, 1.0)
+    m = 30
+    w = m * 2 + (size - 2 * m) * (x_hi - x_lo) / span
+    h = m * 2 + (size - 2 * m) * (y_hi - y_lo) / span
+    w, h = max(w, 240), max(h, 120)
+    sx = Scale(x_lo, x_lo + span, m, m + (size - 2 * m))
+    sy = Scale(y_lo, y_lo + span, m, m + (size - 2 * m))
+
+    body = ['<rect x="%d" y="%d" width="%.0f" height="%.0f" fill="none" stroke="#ddd"/>' % (m, m, w - 2 * m, h - 2 * m)]
+    for n in names:
+        for stroke in acc[n].path.strokes():
+            body.append(polyline(stroke, sx, sy, COLORS[n], 1.5 if "output" == n else 1.0))
+            body.append('<circle cx="%.1f" cy="%.1f" r="2.5" fill="%s"/>' % (sx(stroke[0][0]), sy(stroke[0][1]), MARKER_COLORS["DOWN"]))
+    body.append('<text x="%d" y="%.0f" fill="#666">x %s..%s, y %s..%s</text>' % (m, h - 8, fmt(x_lo, 0), fmt(x_hi, 0), fmt(y_lo, 0), fmt(y_hi, 0)))
+    body.append(legend(names, int(w) - 80 * len(names) - 10, 16))
+
+    return svg_panel(int(w), int(h), title, "".join(body))
+
+
+def time_panel(title, acc, names, key, t_range, width=960, height=200):
+    """ Time series of one axis with down/up markers """
+    strokes = {n: acc[n].env[key].strokes() for n in names}
+    vals = [v for n in names for s in strokes[n] for _, v in s]
+    if not vals:
+        return None
+
+    ml, mr, mt, mb = 60, 10, 26, 24
+    sx = Scale(t_range[0], t_range[1], ml, width - mr)
+    sy = Scale(min(vals), max(vals), height - mb, mt)
+
+    body = ['<rect x="%d" y="%d" width="%d" height="%d" fill="none" stroke="#ddd"/>' % (ml, mt, width - ml - mr, height - mt - mb)]
+
+    # Markers of output when present, else of first series
+    mark = "output" if "output" in names else names[0]
+    for t, evt in acc[mark].markers.items:
+        body.append('<line x1="%.1f" x2="%.1f" y1="%d" y2="%d" stroke="%s" stroke-opacity="0.5"/>' %
+                    (sx(t), sx(t), mt, height - mb, MARKER_COLORS[evt]))
+
+    for n in names:
+        for s in strokes[n]:
+            body.append(polyline(s, sx, sy, COLORS[n], 1.5 if "output" == n else 1.0))
+
+    body.append('<text x="4" y="%d">%s</text><text x="4" y="%d">%s</text>' % (mt + 10, fmt(sy.hi, 0), height - mb, fmt(sy.lo, 0)))
+    body.append('<text x="%d" y="%d">%s ms</text><text x="%d" y="%d" text-anchor="end">%s ms</text>' %
+                (ml, height - 8, fmt(t_range[0], 0), width - mr, height - 8, fmt(t_range[1], 0)))
+    body.append(legend(names, width - 80 * len(names) - 10, 16))
+
+    return svg_panel(width, height, title, "".join(body))
+
+
+def stats_rows(acc, names, units):
+    """ Return header and rows of statistics table """
+    head = ("series", "samples", "strokes", "interval [ms]", "jitter mean", "jitter RMS", "jitter p95",
+            "jitter max", "down latency [ms]", "up latency [ms]")
+    rows = []
+    for n in names:
+        a = acc[n]
+        lat = ["%s (%s..%s)" % (fmt(a.latency[e].mean()), fmt(a.latency[e].min), fmt(a.latency[e].max))
+               if a.latency[e].n else "-" for e in ("DOWN", "UP")]
+        rows.append(("%s [%s]" % (n, units[n]), a.samples, a.strokes, fmt(a.interval.mean(), 2),
+                     fmt(a.jitter.mean(), 2), fmt(a.jitter.rms(), 2), fmt(a.jitter_hist.percentile(95), 2),
+                     fmt(a.jitter.max, 2), lat[0], lat[1]))
+    return head, rows
+
+
+def render(acc, t_range, cal):
+    """ Return (panels, table) """
+    names = [n for n in SERIES if n in acc]
+    units = {n: "px" if ("output" == n or cal) else "ADC" for n in names}
+    panels = []
+
+    px = [n for n in names if "px" == units[n]]
+    adc = [n for n in names if "ADC" == units[n]]
+    if adc:
+        panels.append(path_panel("Path (ADC)", acc, adc))
+    if px:
+        panels.append(path_panel("Path (display)", acc, px))
+
+    for key, title in (("x", "X"), ("y", "Y")):
+        for group, unit in ((adc, "ADC"), (px, "px")):
+            if group:
+                panels.append(time_panel("%s over time [%s]" % (title, unit), acc, group, key, t_range))
+
+    for n in names:
+        panels.append(time_panel("Pressure over time, %s" % n, acc, [n], "p", t_range, height=140))
+
+    return [p for p in panels if p], stats_rows(acc, names, units)
+
+
+def write_html(f, panels, table, info):
+    head, rows = table
+    f.write("<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>XPT2046 trace report</title>\n"
+            "<style>body{font-family:sans-serif;margin:16px}svg{display:block;margin:8px 0}"
+            "table{border-collapse:collapse}td,th{border:1px solid #ccc;padding:3px 8px;text-align:right}"
+            "th{background:#f4f4f4}</style></head><body>\n<h2>XPT2046 trace report</h2>\n")
+    f.write("<p>%s</p>\n" % "<br>".join(html.escape(line) for line in info))
+    f.write("<table><tr>%s</tr>\n" % "".join("<th>%s</th>" % html.escape(h) for h in head))
+    for row in rows:
+        f.write("<tr>%s</tr>\n" % "".join("<td>%s</td>" % html.escape(str(v)) for v in row))
+    f.write("</table>\n")
+    for p in panels:
+        f.write(p + "\n")
+    f.write("</body></html>\n")
+
+
+def write_svg(f, panels, table, info):
+    head, rows = table
+    lines = info + [""] + [" | ".join(head)] + [" | ".join(str(v) for v in row) for row in rows]
+    y = 20
+    parts = []
+    for line in lines:
+        parts.append('<text x="8" y="%d" font-family="monospace" font-size="12">%s</text>' % (y, html.escape(line)))
+        y += 16
+    width = 960
+    for p in panels:
+        w = int(p.split('width="', 1)[1].split('"', 1)[0])
+        h = int(p.split('height="', 1)[1].split('"', 1)[0])
+        parts.append('<g transform="translate(0,%d)">%s</g>' % (y, p))
+        y += h + 8
+        width = max(width, w)
+    f.write('<svg xmlns="http://www.w3.org/2000/svg" width="%d" height="%d">%s</svg>\n' % (width, y, "".join(parts)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate XPT2046 touch trace report")
+    parser.add_argument("-r", "--raw", help="raw input CSV trace (time_ms,pressed,x,y,rt)")
+    parser.add_argument("-f", "--filtered", help="filtered samples CSV with header (time_ms,pressed,x,y[,pressure])")
+    parser.add_argument("-e", "--events", help="pipeline output, evdev events of xpt2046d")
+    parser.add_argument("-s", "--stream", help="pipeline output, touch event stream")
+    parser.add_argument("-k", "--cal", help="calibration factors, maps raw and filtered to display")
+    parser.add_argument("-t", "--offset", type=float, default=0.0, help="time offset of pipeline output [ms]")
+    parser.add_argument("-n", "--max-points", type=int, default=4000, help="max. points kept per series")
+    parser.add_argument("-o", "--output", required=True, help="report file, .html or .svg")
+    args = parser.parse_args()
+
+    if args.events and args.stream:
+        parser.error("give either events or stream as pipeline output")
+
+    try:
+        cal = load_cal(args.cal) if args.cal else None
+        sources = []
+        if args.raw:
+            sources.append(read_csv(args.raw, "raw", cal))
+        if args.filtered:
+            sources.append(read_csv(args.filtered, "filtered", cal))
+        if args.events:
+            sources.append(read_evdev(args.events, args.offset))
+        if args.stream:
+            sources.append(read_stream(args.stream, args.offset))
+        if not sources:
+            raise ValueError("no input given")
+
+        acc, t_range = collect(sources, max(args.max_points, 16))
+        if not acc:
+            raise ValueError("inputs contain no touch")
+
+        panels, table = render(acc, t_range, cal)
+        info = ["Inputs: %s" % ", ".join(os.path.basename(p) for p in (args.raw, args.filtered, args.events, args.stream) if p),
+                "Time: %s .. %s ms" % (fmt(t_range[0], 0), fmt(t_range[1], 0)),
+                "Jitter: magnitude of second difference of position within stroke; latency against raw touch edges"]
+        unmatched = sum(a.unmatched for n, a in acc.items() if "raw" != n)
+        if args.raw and unmatched:
+            info.append("Touch edges without raw edge: %d" % unmatched)
+
+        with open(args.output, "w") as f:
+            if args.output.endswith(".svg"):
+                write_svg(f, panels, table, info)
+            else:
+                write_html(f, panels, table, info)
+
+    except (OSError, ValueError, struct.error) as e:
+        sys.stderr.write("xpt2046_report: %s\n" % e)
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
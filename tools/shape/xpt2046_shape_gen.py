@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+#
+#  @file      xpt2046_shape_gen.py
+#  @brief     Shape recognizer template generator for XPT2046
+#  @author    Ziga Miklosic
+#  @date      18.10.2026
+#  @version   V1.1.0
+#
+################################################################################
+"""
+Generate xpt2046_shape_tmpl.h with point cloud templates for shape
+recognizer (see XPT2046_SHAPE_EN).
+
+Built-in shapes: check, x, circle and digits 0..9. Own shapes (or other
+writing styles of built-in ones) are added from JSON file, each shape is
+list of strokes and each stroke list of [x, y] points in any units:
+
+    { "triangle": [ [[0,100], [50,0], [100,100], [0,100]] ],
+      "4-open":   [ [[60,0], [0,70], [80,70]], [[60,40], [60,100]] ] }
+
+Strokes can be recorded on device, e.g. from xpt2046_ink_get() points or
+decoded touch stream (tools/stream). Same shape can be given several
+times under names "name", "name-2"... to cover writing variants.
+
+Usage:
+    xpt2046_shape_gen.py -o xpt2046_shape_tmpl.h
+    xpt2046_shape_gen.py -s check,x,circle -j my_shapes.json -o xpt2046_shape_tmpl.h
+"""
+
+import argparse
+import json
+import math
+import sys
+
+# Normalization, see xpt2046_shape.h
+SHAPE_POINTS = 32
+SHAPE_SCALE = 127
+
+# Max. number of templates
+SHAPE_TMPL_MAX = 254
+
+
+def arc(cx, cy, rx, ry, a0, a1, num=16):
+    """ Elliptic arc from angle a0 to a1 in degrees (y axis down) """
+    return [(cx + rx * math.cos(math.radians(a0 + (a1 - a0) * i / num)),
+             cy + ry * math.sin(math.radians(a0 + (a1 - a0) * i / num))) for i in range(num + 1)]
+
+
+# Built-in shapes, strokes in 0..100 units, y axis down
+BUILTIN = {
+    "check": [[(0, 55), (35, 90), (100, 0)]],
+    "x": [[(0, 0), (100, 100)], [(100, 0), (0, 100)]],
+    "circle": [arc(50, 50, 50, 50, 270, -90, 32)],
+    "0": [arc(35, 50, 35, 50, 270, -90, 32)],
+    "1": [[(25, 20), (50, 0), (50, 100)]],
+    "2": [arc(35, 30, 35, 30, 180, 380) + [(0, 100), (70, 100)]],
+    "3": [arc(35, 25, 35, 25, 200, 450) + arc(35, 75, 35, 25, 270, 520)],
+    "4": [[(55, 0), (0, 65), (75, 65)], [(55, 30), (55, 100)]],
+    "5": [[(70, 0), (10, 0), (5, 45)] + arc(35, 70, 32, 30, 225, 510)],
+    "6": [[(60, 0), (20, 30)] + arc(33, 70, 33, 30, 180, 540)],
+    "7": [[(0, 0), (75, 0), (25, 100)]],
+    "8": [arc(35, 25, 28, 25, 90, 450) + arc(35, 75, 35, 25, 270, 630)],
+    "9": [arc(35, 28, 33, 28, 0, 360) + [(65, 100)]],
+}
+
+
+def path_len(strokes):
+    """ Length along strokes """
+    return sum(math.dist(s[i - 1], s[i]) for s in strokes for i in range(1, len(s)))
+
+
+def resample(strokes, num):
+    """ Resample to num equidistant points along strokes, same as driver """
+    interval = path_len(strokes) / (num - 1)
+    out = [tuple(strokes[0][0])]
+    acc = 0.0
+
+    for stroke in strokes:
+        # Next stroke starts at its first point
+        prev = tuple(stroke[0])
+        i = 1
+        while i < len(stroke) and len(out) < num:
+            cur = tuple(stroke[i])
+            d = math.dist(prev, cur)
+            if d > 0 and acc + d >= interval:
+                t = (interval - acc) / d
+                prev = (prev[0] + t * (cur[0] - prev[0]), prev[1] + t * (cur[1] - prev[1]))
+                out.append(prev)
+                acc = 0.0
+            else:
+                acc += d
+                prev = cur
+                i += 1
+
+    last = tuple(strokes[-1][-1])
+    while len(out) < num:
+        out.append(last)
+
+    return out[:num]
+
+
+def normalize(points):
+    """ Uniform scale to SHAPE_SCALE box and move to centroid, same as driver """
+    min_x = min(p[0] for p in points)
+    min_y = min(p[1] for p in points)
+    size = max(max(p[0] for p in points) - min_x, max(p[1] for p in points) - min_y) or 1.0
+
+    scaled = [(round((x - min_x) * SHAPE_SCALE / size), round((y - min_y) * SHAPE_SCALE / size)) for x, y in points]
+    cx = round(sum(p[0] for p in scaled) / len(scaled))
+    cy = round(sum(p[1] for p in scaled) / len(scaled))
+
+    return [(x - cx, y - cy) for x, y in scaled]
+
+
+def make_template(strokes):
+    strokes = [[tuple(p) for p in s] for s in strokes if len(s) > 0]
+
+    if not strokes or 0 == path_len(strokes):
+        raise ValueError("shape has no length")
+
+    return normalize(resample(strokes, SHAPE_POINTS))
+
+
+def gen_header(templates, source):
+    lines = [
+        "// Generated by tools/shape/xpt2046_shape_gen.py, do not edit!",
+        "// Source: %s" % source,
+        "//",
+        "// Point cloud templates for XPT2046 shape recognizer (see XPT2046_SHAPE_EN)",
+        "",
+        "#ifndef _XPT2046_SHAPE_TMPL_H_",
+        "#define _XPT2046_SHAPE_TMPL_H_",
+        "",
+        "#define XPT2046_SHAPE_TMPL_POINTS\t\t\t( %dU )" % SHAPE_POINTS,
+        "#define XPT2046_SHAPE_TMPL_NUM\t\t\t\t( %dU )" % len(templates),
+        "",
+        "// Template names, index is template id",
+        "static const char * const gc_xpt2046_shape_name[ XPT2046_SHAPE_TMPL_NUM ] =",
+        "{",
+    ]
+
+    for i, (name, _) in enumerate(templates):
+        lines.append("\t%-24s// %d" % ("\"%s\"," % name, i))
+
+    lines += [
+        "};",
+        "",
+        "// Normalized point clouds [x, y]",
+        "static const int8_t gc_xpt2046_shape_tmpl[ XPT2046_SHAPE_TMPL_NUM ][ XPT2046_SHAPE_TMPL_POINTS ][2] =",
+        "{",
+    ]
+
+    for name, pts in templates:
+        lines.append("\t// %s" % name)
+        lines.append("\t{")
+        for i in range(0, len(pts), 8):
+            lines.append("\t\t" + " ".join("{ %d, %d }," % p for p in pts[i:i + 8]))
+        lines.append("\t},")
+
+    lines += [
+        "};",
+        "",
+        "#endif // _XPT2046_SHAPE_TMPL_H_",
+        "",
+    ]
+
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate XPT2046 shape recognizer templates")
+    parser.add_argument("-s", "--select", help="comma separated built-in shapes (default all, 'none' for no built-in)")
+    parser.add_argument("-j", "--json", action="append", default=[], help="JSON file with own shapes")
+    parser.add_argument("-o", "--output", help="output header (default: stdout)")
+    args = parser.parse_args()
+
+    try:
+        if args.select is None:
+            names = list(BUILTIN)
+        elif "none" == args.select:
+            names = []
+        else:
+            names = [n.strip() for n in args.select.split(",")]
+
+        shapes = []
+        for name in names:
+            if name not in BUILTIN:
+                raise ValueError("unknown built-in shape '%s', available: %s" % (name, ", ".join(BUILTIN)))
+            shapes.append((name, BUILTIN[name]))
+
+        for path in args.json:
+            with open(path) as f:
+                shapes += list(json.load(f).items())
+
+        if not shapes:
+            raise ValueError("no shapes given")
+
+        if len(shapes) > SHAPE_TMPL_MAX:
+            raise ValueError("too many shapes (%d), max. %d" % (len(shapes), SHAPE_TMPL_MAX))
+
+        templates = []
+        for name, strokes in shapes:
+            if not all(c.isalnum() or c in "-_ " for c in name):
+                raise ValueError("invalid shape name '%s'" % name)
+            try:
+                templates.append((name, make_template(strokes)))
+            except (TypeError, IndexError, ValueError) as e:
+                raise ValueError("shape '%s': %s" % (name, e))
+
+    except (OSError, ValueError) as e:
+        sys.stderr.write("xpt2046_shape_gen: %s\n" % e)
+        return 1
+
+    source = ", ".join((["built-in"] if names else []) + args.json)
+    header = gen_header(templates, source)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(header)
+    else:
+        sys.stdout.write(header)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
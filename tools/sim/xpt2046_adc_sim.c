@@ -0,0 +1,428 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_adc_sim.c
+*@brief     Simulated resistive panel for controller-less backend
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_ADC_SIM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Simulated resistive panel, MCU GPIO and ADC for host testing.
+*
+* 	Drop-in replacement of xpt2046_if.c (template/xpt2046_if_adc.htmp
+* 	interface) on host. Panel is modelled as two resistive plates
+* 	connected at touch point through touch resistance. Voltages at touch
+* 	points are solved from plate terminal drive for every sample, thus
+* 	X, Y, Z1 and Z2 measurements follow the real plate physics including
+* 	pull-up pen detection.
+*
+* 	ADC input settles exponentially towards new voltage after plate
+* 	drive change (panel capacitance), with per-sample factor alpha.
+*
+* 	Positions x, y are fractions (0..1) of plate length measured from
+* 	X- and Y- terminal.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "xpt2046_adc_sim.h"
+#include "xpt2046_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// ADC full scale (12-bit)
+#define ADC_SIM_MAX					( 4095.0 )
+
+// Min. plate segment resistance [ohm]
+#define ADC_SIM_R_MIN				( 1.0 )
+
+// Panel model
+typedef struct
+{
+	double					rx;			// X plate resistance [ohm]
+	double					ry;			// Y plate resistance [ohm]
+	double					r_pullup;	// GPIO pull-up resistance [ohm]
+	double					alpha;		// Settling factor per sample
+	uint32_t				noise;		// Noise amplitude [LSB]
+
+	bool					touched;
+	double					x;
+	double					y;
+	double					rt;
+
+	xpt2046_plate_mode_t	mode[ eXPT2046_PLATE_NUM_OF ];
+	double					v_adc[ eXPT2046_PLATE_NUM_OF ];	// Settled ADC input voltage
+	uint32_t				samples;
+} adc_sim_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+static adc_sim_t g_sim =
+{
+	.rx 		= 400.0,
+	.ry 		= 300.0,
+	.r_pullup 	= 40000.0,
+	.alpha 		= 0.5,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static double adc_sim_pin_voltage	(const xpt2046_plate_t plate);
+static double adc_sim_seg			(const double r);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set panel electrical parameters
+*
+* @param[in]	rx			- X plate resistance [ohm]
+* @param[in]	ry			- Y plate resistance [ohm]
+* @param[in]	r_pullup	- GPIO pull-up resistance [ohm]
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_adc_sim_set_panel(const double rx, const double ry, const double r_pullup)
+{
+	g_sim.rx = rx;
+	g_sim.ry = ry;
+	g_sim.r_pullup = r_pullup;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set ADC noise amplitude
+*
+* @param[in]	noise_lsb	- Uniform noise amplitude [LSB]
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_adc_sim_set_noise(const uint32_t noise_lsb)
+{
+	g_sim.noise = noise_lsb;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set ADC input settling factor
+*
+* @param[in]	alpha	- Fraction of remaining error removed per sample (0..1]
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_adc_sim_set_settle(const double alpha)
+{
+	g_sim.alpha = alpha;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Touch panel
+*
+* @param[in]	x	- X position (0..1)
+* @param[in]	y	- Y position (0..1)
+* @param[in]	rt	- Touch resistance [ohm]
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_adc_sim_touch(const double x, const double y, const double rt)
+{
+	g_sim.x = x;
+	g_sim.y = y;
+	g_sim.rt = rt;
+	g_sim.touched = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release panel
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_adc_sim_release(void)
+{
+	g_sim.touched = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of ADC samples taken
+*
+* @return 		samples - Number of samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t xpt2046_adc_sim_get_samples(void)
+{
+	return g_sim.samples;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize low level interface
+*
+* @return 		status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_if_init(void)
+{
+	return eXPT2046_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Exchange data via SPI (not used)
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_if_spi_transmit_receive(const uint8_t * p_tx, uint8_t * const p_rx, const uint32_t size, const spi_cs_action_t cs_action)
+{
+	(void) p_tx;
+	(void) p_rx;
+	(void) size;
+	(void) cs_action;
+
+	return eXPT2046_ERROR;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get state of IRQ touch line (not used)
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool xpt2046_if_get_int(void)
+{
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set SPI clock (not used)
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_if_spi_set_clk(const uint8_t idx)
+{
+	(void) idx;
+
+	return eXPT2046_ERROR;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set plate terminal pin mode
+*
+* @param[in]	plate	- Plate terminal
+* @param[in]	mode	- Pin mode
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void xpt2046_if_plate_drive(const xpt2046_plate_t plate, const xpt2046_plate_mode_t mode)
+{
+	if ( plate < eXPT2046_PLATE_NUM_OF )
+	{
+		g_sim.mode[ plate ] = mode;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read plate terminal digital level
+*
+* @param[in]	plate	- Plate terminal
+* @return 		high	- True if pin level is high
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool xpt2046_if_plate_read(const xpt2046_plate_t plate)
+{
+	return ( adc_sim_pin_voltage( plate ) > 0.5 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sample plate terminal voltage
+*
+* @param[in]	plate	- Plate terminal
+* @param[out]	p_buf	- Pointer to sample buffer
+* @param[in]	num		- Number of samples
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+xpt2046_status_t xpt2046_if_adc_sample(const xpt2046_plate_t plate, uint16_t * const p_buf, const uint32_t num)
+{
+	const double v = adc_sim_pin_voltage( plate );
+	double adc;
+	uint32_t i;
+
+	for ( i = 0; i < num; i++ )
+	{
+		g_sim.v_adc[ plate ] += ( v - g_sim.v_adc[ plate ] ) * g_sim.alpha;
+
+		adc = g_sim.v_adc[ plate ] * ADC_SIM_MAX;
+
+		if ( g_sim.noise > 0U )
+		{
+			adc += (double)(( rand() % (int)( 2U * g_sim.noise + 1U )) - (int) g_sim.noise );
+		}
+
+		if ( adc < 0.0 )
+		{
+			adc = 0.0;
+		}
+		else if ( adc > ADC_SIM_MAX )
+		{
+			adc = ADC_SIM_MAX;
+		}
+		else
+		{
+			// No actions...
+		}
+
+		p_buf[i] = (uint16_t)( adc + 0.5 );
+	}
+
+	g_sim.samples += num;
+
+	return eXPT2046_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Solve plate terminal voltage
+*
+* @note		Touch points on X (Tx) and Y (Ty) plate are the only internal
+* 			nodes. Each is connected to both plate terminals through plate
+* 			segments and to each other through touch resistance. Driven
+* 			terminals are voltage sources, pull-up terminals are 1 V sources
+* 			behind pull-up resistance, high impedance terminals are open.
+*
+* @param[in]	plate	- Plate terminal
+* @return 		v		- Terminal voltage (0..1)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double adc_sim_pin_voltage(const xpt2046_plate_t plate)
+{
+	// Segment resistances from touch point to terminal
+	const double r_seg[ eXPT2046_PLATE_NUM_OF ] =
+	{
+		[ eXPT2046_PLATE_XP ] = adc_sim_seg( g_sim.rx * ( 1.0 - g_sim.x )),
+		[ eXPT2046_PLATE_XN ] = adc_sim_seg( g_sim.rx * g_sim.x ),
+		[ eXPT2046_PLATE_YP ] = adc_sim_seg( g_sim.ry * ( 1.0 - g_sim.y )),
+		[ eXPT2046_PLATE_YN ] = adc_sim_seg( g_sim.ry * g_sim.y ),
+	};
+	double g[ eXPT2046_PLATE_NUM_OF ];		// Conductance terminal source to node
+	double vs[ eXPT2046_PLATE_NUM_OF ];		// Terminal source voltage
+	double a11, a12, a22, b1, b2, det;
+	double gt;
+	double vx, vy, v_node;
+	uint32_t i;
+
+	for ( i = 0; i < eXPT2046_PLATE_NUM_OF; i++ )
+	{
+		switch( g_sim.mode[i] )
+		{
+			case eXPT2046_PLATE_LOW:
+				g[i] = 1.0 / r_seg[i];
+				vs[i] = 0.0;
+				break;
+
+			case eXPT2046_PLATE_HIGH:
+				g[i] = 1.0 / r_seg[i];
+				vs[i] = 1.0;
+				break;
+
+			case eXPT2046_PLATE_PULLUP:
+				g[i] = 1.0 / ( r_seg[i] + g_sim.r_pullup );
+				vs[i] = 1.0;
+				break;
+
+			case eXPT2046_PLATE_HIZ:
+			default:
+				g[i] = 0.0;
+				vs[i] = 0.0;
+				break;
+		}
+	}
+
+	gt = ( true == g_sim.touched ) ? ( 1.0 / adc_sim_seg( g_sim.rt )) : 0.0;
+
+	// Nodal equations
+	a11 = g[ eXPT2046_PLATE_XP ] + g[ eXPT2046_PLATE_XN ] + gt;
+	a22 = g[ eXPT2046_PLATE_YP ] + g[ eXPT2046_PLATE_YN ] + gt;
+	a12 = -gt;
+	b1 	= g[ eXPT2046_PLATE_XP ] * vs[ eXPT2046_PLATE_XP ] + g[ eXPT2046_PLATE_XN ] * vs[ eXPT2046_PLATE_XN ];
+	b2 	= g[ eXPT2046_PLATE_YP ] * vs[ eXPT2046_PLATE_YP ] + g[ eXPT2046_PLATE_YN ] * vs[ eXPT2046_PLATE_YN ];
+
+	// Floating plate rests at ground
+	if ( a11 <= 0.0 )
+	{
+		a11 = 1.0;
+		b1 = 0.0;
+	}
+
+	if ( a22 <= 0.0 )
+	{
+		a22 = 1.0;
+		b2 = 0.0;
+	}
+
+	det = a11 * a22 - a12 * a12;
+	vx = ( b1 * a22 - a12 * b2 ) / det;
+	vy = ( a11 * b2 - a12 * b1 ) / det;
+
+	v_node = (( eXPT2046_PLATE_XP == plate ) || ( eXPT2046_PLATE_XN == plate )) ? vx : vy;
+
+	switch( g_sim.mode[ plate ] )
+	{
+		case eXPT2046_PLATE_LOW:
+			v_node = 0.0;
+			break;
+
+		case eXPT2046_PLATE_HIGH:
+			v_node = 1.0;
+			break;
+
+		case eXPT2046_PLATE_PULLUP:
+			v_node = v_node + ( 1.0 - v_node ) * r_seg[ plate ] / ( r_seg[ plate ] + g_sim.r_pullup );
+			break;
+
+		case eXPT2046_PLATE_HIZ:
+		default:
+			break;
+	}
+
+	return v_node;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Limit segment resistance
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double adc_sim_seg(const double r)
+{
+	return ( r < ADC_SIM_R_MIN ) ? ADC_SIM_R_MIN : r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,39 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_adc_sim.h
+*@brief     Simulated resistive panel for controller-less backend
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_ADC_SIM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Simulated resistive panel, MCU GPIO and ADC for host testing.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_ADC_SIM_H_
+#define _XPT2046_ADC_SIM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+void		xpt2046_adc_sim_set_panel	(const double rx, const double ry, const double r_pullup);
+void		xpt2046_adc_sim_set_noise	(const uint32_t noise_lsb);
+void		xpt2046_adc_sim_set_settle	(const double alpha);
+void		xpt2046_adc_sim_touch		(const double x, const double y, const double rt);
+void		xpt2046_adc_sim_release		(void);
+uint32_t	xpt2046_adc_sim_get_samples	(void);
+
+#endif // _XPT2046_ADC_SIM_H_
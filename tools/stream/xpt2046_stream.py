@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Ziga Miklosic
+# All Rights Reserved
+# This software is under MIT licence (https://opensource.org/licenses/MIT)
+################################################################################
+#
+#  @file      xpt2046_stream.py
+#  @brief     Touch event stream decoder for XPT2046
+#  @author    Ziga Miklosic
+#  @date      18.10.2026
+#  @version   V1.1.0
+#
+################################################################################
+"""
+Decode touch event stream produced by xpt2046_stream_encode().
+
+Can be used as library:
+
+    from xpt2046_stream import StreamDecoder
+
+    dec = StreamDecoder()
+    for evt in dec.feed(data):
+        print(evt.type, evt.x, evt.y)
+
+or from command line, printing one event per line:
+
+    xpt2046_stream.py stream.bin
+    cat /dev/ttyUSB0 | xpt2046_stream.py -
+
+Decoder starts unsynchronized and waits for first valid key record, delta
+records before it are dropped. Record with bad CRC drops synchronization
+until next key record, thus corrupted or lost bytes on link never produce
+wrong coordinates.
+"""
+
+import argparse
+import collections
+import sys
+
+# Record layout, see xpt2046_stream.h
+STREAM_SYNC_0 = 0xC3
+STREAM_SYNC_1 = 0x5A
+STREAM_KEY_SIZE = 14
+
+STREAM_DELTA_TAG = 0x80
+STREAM_DELTA_TAG_MASK = 0xC0
+STREAM_DELTA_TYPE_SHIFT = 4
+STREAM_DELTA_PRESSURE = 0x08
+
+# Max. varint length of 32-bit value
+VARINT_MAX = 5
+
+EVT_NAMES = ("DOWN", "MOVE", "UP")
+
+Event = collections.namedtuple("Event", "type timestamp x y pressure")
+
+
+def crc8(data):
+    """ CRC-8, polynomial 0x07, initial value 0 """
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def get_varint(buf, pos):
+    """ Return (value, next position), None if incomplete, ValueError if too long """
+    val = 0
+    for i in range(VARINT_MAX):
+        if pos + i >= len(buf):
+            return None
+        b = buf[pos + i]
+        val |= (b & 0x7F) << (7 * i)
+        if 0 == (b & 0x80):
+            return val, pos + i + 1
+    raise ValueError("varint too long")
+
+
+def unzigzag(val):
+    """ Inverse of zigzag mapping """
+    return (val >> 1) ^ -(val & 1)
+
+
+class StreamDecoder:
+    """ Incremental stream decoder """
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.synced = False
+        self.last = None
+        self.skipped = 0
+        self.resyncs = 0
+
+    def feed(self, data):
+        """ Add received bytes, return list of decoded events """
+        self.buf += data
+        events = []
+
+        while self.buf:
+            res = self._parse()
+
+            # Wait for rest of record
+            if res is None:
+                break
+
+            size, evt = res
+
+            if evt is None:
+                # Not a valid record, skip byte and search again
+                if self.synced:
+                    self.synced = False
+                    self.resyncs += 1
+                self.skipped += 1
+                del self.buf[:1]
+            else:
+                del self.buf[:size]
+                self.last = evt
+                events.append(evt)
+
+        return events
+
+    def _parse(self):
+        """ Return (size, event) of record at start of buffer, event is None on error """
+        buf = self.buf
+
+        if STREAM_SYNC_0 == buf[0]:
+            if len(buf) < 2:
+                return None
+            if STREAM_SYNC_1 == buf[1]:
+                return self._parse_key()
+
+        if self.synced and STREAM_DELTA_TAG == (buf[0] & STREAM_DELTA_TAG_MASK):
+            return self._parse_delta()
+
+        return 1, None
+
+    def _parse_key(self):
+        buf = self.buf
+
+        if len(buf) < STREAM_KEY_SIZE:
+            return None
+
+        if crc8(buf[:STREAM_KEY_SIZE - 1]) != buf[STREAM_KEY_SIZE - 1] or buf[2] >= len(EVT_NAMES):
+            return 1, None
+
+        ts = int.from_bytes(buf[3:7], "little")
+        x = int.from_bytes(buf[7:9], "little")
+        y = int.from_bytes(buf[9:11], "little")
+        p = int.from_bytes(buf[11:13], "little")
+
+        self.synced = True
+
+        return STREAM_KEY_SIZE, Event(buf[2], ts, x, y, p)
+
+    def _parse_delta(self):
+        buf = self.buf
+        hdr = buf[0]
+        evt_type = (hdr >> STREAM_DELTA_TYPE_SHIFT) & 0x03
+        fields = 4 if hdr & STREAM_DELTA_PRESSURE else 3
+
+        if (hdr & 0x07) or evt_type >= len(EVT_NAMES):
+            return 1, None
+
+        vals = []
+        pos = 1
+        try:
+            for _ in range(fields):
+                res = get_varint(buf, pos)
+                if res is None:
+                    return None
+                val, pos = res
+                vals.append(val)
+        except ValueError:
+            return 1, None
+
+        if pos >= len(buf):
+            return None
+
+        if crc8(buf[:pos]) != buf[pos]:
+            return 1, None
+
+        last = self.last
+        dp = unzigzag(vals[3]) if 4 == fields else 0
+
+        evt = Event(evt_type,
+                    (last.timestamp + vals[0]) & 0xFFFFFFFF,
+                    (last.x + unzigzag(vals[1])) & 0xFFFF,
+                    (last.y + unzigzag(vals[2])) & 0xFFFF,
+                    (last.pressure + dp) & 0xFFFF)
+
+        return pos + 1, evt
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode XPT2046 touch event stream")
+    parser.add_argument("input", help="stream file or - for stdin")
+    args = parser.parse_args()
+
+    dec = StreamDecoder()
+    stream = sys.stdin.buffer if "-" == args.input else open(args.input, "rb")
+
+    with stream:
+        while True:
+            chunk = stream.read(4096)
+            if not chunk:
+                break
+            for evt in dec.feed(chunk):
+                sys.stdout.write("[%10u ms] %-4s x=%4u y=%4u p=%5u\n" %
+                                 (evt.timestamp, EVT_NAMES[evt.type], evt.x, evt.y, evt.pressure))
+
+    if dec.skipped:
+        sys.stderr.write("xpt2046_stream: skipped %d bytes, %d resyncs\n" % (dec.skipped, dec.resyncs))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
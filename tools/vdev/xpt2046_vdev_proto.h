@@ -0,0 +1,95 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_vdev_proto.h
+*@brief     XPT2046 virtual device protocol
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_VDEV_PROTO
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Protocol between host XPT2046 interface backend (client) and
+* 	virtual device server over Unix domain stream socket.
+*
+* 	Each request is answered by exactly one response. All multi-byte
+* 	fields are little endian.
+*
+* 	Request:	[type:u8][reserved:u8][len:u16][payload:len]
+* 	Response:	[type:u8][penirq:u8][len:u16][time_us:u32][payload:len]
+*
+* 	Every response carries PENIRQ state and virtual time of the device,
+* 	thus client does not need extra round trips to poll them.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _XPT2046_VDEV_PROTO_H_
+#define _XPT2046_VDEV_PROTO_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Default socket path
+#define XPT2046_VDEV_SOCK_DEF				( "/tmp/xpt2046_vdev.sock" )
+
+// Environment variable overriding socket path
+#define XPT2046_VDEV_SOCK_ENV				( "XPT2046_VDEV_SOCK" )
+
+// Header sizes
+#define XPT2046_VDEV_REQ_HEAD_SIZE			( 4U )
+#define XPT2046_VDEV_RSP_HEAD_SIZE			( 8U )
+
+// Max. payload size
+#define XPT2046_VDEV_PAYLOAD_MAX			( 256U )
+
+// Message types
+typedef enum
+{
+	/**
+	 * 	Full duplex SPI transfer with CS low for whole payload.
+	 *
+	 * 	Request payload: MOSI bytes
+	 * 	Response payload: MISO bytes (same length)
+	 */
+	eXPT2046_VDEV_MSG_XFER = 0x01,
+
+	/**
+	 * 	Advance virtual time.
+	 *
+	 * 	Request payload: [ms:u32]
+	 * 	Response payload: none
+	 */
+	eXPT2046_VDEV_MSG_ADVANCE = 0x02,
+
+	/**
+	 * 	Set SPI clock.
+	 *
+	 * 	Request payload: [hz:u32]
+	 * 	Response payload: none
+	 */
+	eXPT2046_VDEV_MSG_SET_CLK = 0x03,
+
+	/**
+	 * 	Error response to unknown or malformed request
+	 */
+	eXPT2046_VDEV_MSG_ERROR = 0x7F,
+} xpt2046_vdev_msg_t;
+
+#endif // _XPT2046_VDEV_PROTO_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
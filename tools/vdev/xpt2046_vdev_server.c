@@ -0,0 +1,700 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      xpt2046_vdev_server.c
+*@brief     XPT2046 virtual device server
+*@author    Ziga Miklosic
+*@date      18.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup XPT2046_VDEV_SERVER
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Reference XPT2046 virtual device server for host simulation.
+*
+* 	Emulates chip at byte level: control byte (S bit, channel address,
+* 	8/12-bit mode, power down bits), conversion result clocked out
+* 	MSB first in following 16 clocks and PENIRQ enabled only while
+* 	PD0 is cleared. Device time is virtual and advances by SPI clock
+* 	cycles and by explicit ADVANCE requests from client.
+*
+* 	Optional settling model (-a) charges sample capacitor through panel
+* 	with time constant tau during acquisition window of three SPI clocks,
+* 	starting from value of previous conversion. At fast SPI clock result
+* 	is pulled towards previously converted channel, as on real panel
+* 	with high plate resistance. Client changes clock with SET_CLK.
+*
+* 	Touch is driven either from stdin commands:
+*
+* 		down <x> <y> <rt>	- Press at raw ADC position with touch resistance
+* 		move <x> <y>		- Move while pressed
+* 		up					- Release
+*
+* 	or from CSV trace (-t), played against virtual time:
+*
+* 		<time_ms>,<pressed>,<x>,<y>,<rt>
+*
+* 	Build:	gcc -std=gnu99 -O2 -o xpt2046_vdev xpt2046_vdev_server.c
+* 	Usage:	xpt2046_vdev [-s socket] [-c spi_clk_hz] [-n noise_lsb] [-a tau_ns] [-t trace.csv]
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "xpt2046_vdev_proto.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Default SPI clock [Hz]
+#define VDEV_SPI_CLK_DEF			( 2000000UL )
+
+// ADC full scale (12-bit)
+#define VDEV_ADC_MAX				( 4095 )
+
+// Acquisition window [SPI clocks]
+#define VDEV_ACQ_CLK				( 3U )
+
+// Z2 conversion reference used to synthesize Z1/Z2 from touch resistance
+#define VDEV_Z2_REF					( 4000U )
+
+// Fixed readouts of auxiliary channels (12-bit)
+#define VDEV_TEMP0_ADC				( 983 )		// ~600 mV @ 25 degC
+#define VDEV_TEMP1_ADC				( 1130 )	// ~690 mV @ 25 degC
+#define VDEV_VBAT_ADC				( 1474 )	// 3.6 V / 4
+#define VDEV_AUX_ADC				( 0 )
+
+// Control byte fields
+#define VDEV_CTRL_S					( 0x80U )
+#define VDEV_CTRL_ADDR(c)			((( c ) >> 4 ) & 0x07U )
+#define VDEV_CTRL_MODE_8BIT(c)		( 0U != (( c ) & 0x08U ))
+#define VDEV_CTRL_PD(c)				(( c ) & 0x03U )
+
+// Channel addresses
+enum
+{
+	eVDEV_CH_TEMP0 = 0,
+	eVDEV_CH_Y,
+	eVDEV_CH_VBAT,
+	eVDEV_CH_Z1,
+	eVDEV_CH_Z2,
+	eVDEV_CH_X,
+	eVDEV_CH_AUX,
+	eVDEV_CH_TEMP1,
+};
+
+// Touch state
+typedef struct
+{
+	bool		pressed;
+	uint16_t	x;
+	uint16_t	y;
+	uint16_t	rt;
+} vdev_touch_t;
+
+// Chip state
+typedef struct
+{
+	uint8_t		pd;			// Power down bits of last control byte
+	uint16_t	shift;		// Output shift register
+	uint64_t	time_ns;	// Virtual time
+	uint32_t	spi_clk;	// SPI clock [Hz]
+	uint32_t	noise;		// Position noise amplitude [LSB]
+	uint32_t	tau_ns;		// Acquisition settling time constant [ns], 0 for ideal
+	double		hold;		// Sample capacitor voltage of last conversion [LSB]
+} vdev_chip_t;
+
+// Trace player
+typedef struct
+{
+	FILE *			p_file;
+	vdev_touch_t	next;
+	uint64_t		next_ms;
+	bool			next_valid;
+} vdev_trace_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+static vdev_touch_t g_touch;
+static vdev_chip_t 	g_chip;
+static vdev_trace_t g_trace;
+static bool			g_stdin_eof = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t	vdev_convert		(const uint8_t ctrl);
+static int32_t	vdev_settle			(const int32_t adc);
+static double	vdev_exp_neg		(double x);
+static uint8_t	vdev_spi_byte		(const uint8_t mosi);
+static bool		vdev_penirq			(void);
+static void		vdev_advance_ns		(const uint64_t ns);
+static void		vdev_trace_next		(void);
+static void		vdev_stdin_cmd		(void);
+static bool		vdev_read_all		(const int fd, uint8_t * p_buf, uint32_t len);
+static bool		vdev_write_all		(const int fd, const uint8_t * p_buf, uint32_t len);
+static bool		vdev_serve			(const int fd);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Virtual device server entry
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	const char * p_path = XPT2046_VDEV_SOCK_DEF;
+	struct sockaddr_un addr;
+	struct pollfd pfd[2];
+	int srv_fd;
+	int cli_fd = -1;
+	int opt;
+
+	g_chip.spi_clk = VDEV_SPI_CLK_DEF;
+
+	while ( -1 != ( opt = getopt( argc, argv, "s:c:n:a:t:" )))
+	{
+		switch( opt )
+		{
+			case 's':
+				p_path = optarg;
+				break;
+
+			case 'c':
+				g_chip.spi_clk = (uint32_t) strtoul( optarg, NULL, 0 );
+				break;
+
+			case 'n':
+				g_chip.noise = (uint32_t) strtoul( optarg, NULL, 0 );
+				break;
+
+			case 'a':
+				g_chip.tau_ns = (uint32_t) strtoul( optarg, NULL, 0 );
+				break;
+
+			case 't':
+				g_trace.p_file = fopen( optarg, "r" );
+				if ( NULL == g_trace.p_file )
+				{
+					perror( optarg );
+					return 1;
+				}
+				vdev_trace_next();
+				break;
+
+			default:
+				fprintf( stderr, "usage: %s [-s socket] [-c spi_clk_hz] [-n noise_lsb] [-a tau_ns] [-t trace.csv]\n", argv[0] );
+				return 1;
+		}
+	}
+
+	if ( 0U == g_chip.spi_clk )
+	{
+		g_chip.spi_clk = VDEV_SPI_CLK_DEF;
+	}
+
+	memset( &addr, 0, sizeof( addr ));
+	addr.sun_family = AF_UNIX;
+	strncpy( addr.sun_path, p_path, sizeof( addr.sun_path ) - 1U );
+	(void) unlink( p_path );
+
+	srv_fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+
+	if 	(	( srv_fd < 0 )
+		||	( 0 != bind( srv_fd, (struct sockaddr*) &addr, sizeof( addr )))
+		||	( 0 != listen( srv_fd, 1 )))
+	{
+		perror( p_path );
+		return 1;
+	}
+
+	fprintf( stderr, "xpt2046 vdev: listening on %s, SPI %u Hz, tau %u ns\n", p_path, (unsigned) g_chip.spi_clk, (unsigned) g_chip.tau_ns );
+
+	for (;;)
+	{
+		// Serve single client at a time
+		pfd[0].fd 		= ( cli_fd < 0 ) ? srv_fd : cli_fd;
+		pfd[0].events 	= POLLIN;
+		pfd[1].fd 		= (( NULL == g_trace.p_file ) && ( false == g_stdin_eof )) ? STDIN_FILENO : -1;
+		pfd[1].events 	= POLLIN;
+
+		if ( poll( pfd, 2, -1 ) < 0 )
+		{
+			break;
+		}
+
+		if ( 0 != ( pfd[1].revents & ( POLLIN | POLLHUP )))
+		{
+			vdev_stdin_cmd();
+		}
+
+		if ( 0 != ( pfd[0].revents & ( POLLIN | POLLHUP )))
+		{
+			if ( cli_fd < 0 )
+			{
+				cli_fd = accept( srv_fd, NULL, NULL );
+			}
+			else if ( false == vdev_serve( cli_fd ))
+			{
+				(void) close( cli_fd );
+				cli_fd = -1;
+			}
+			else
+			{
+				// No actions...
+			}
+		}
+	}
+
+	(void) close( srv_fd );
+	(void) unlink( p_path );
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Serve single client request
+*
+* @param[in]	fd		- Client socket
+* @return 		alive	- False if client disconnected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool vdev_serve(const int fd)
+{
+	uint8_t req[ XPT2046_VDEV_REQ_HEAD_SIZE + XPT2046_VDEV_PAYLOAD_MAX ];
+	uint8_t rsp[ XPT2046_VDEV_RSP_HEAD_SIZE + XPT2046_VDEV_PAYLOAD_MAX ];
+	uint32_t len;
+	uint32_t rsp_len = 0U;
+	uint32_t time_us;
+	uint32_t clk = 0U;
+	uint32_t i;
+	bool alive;
+
+	alive = vdev_read_all( fd, req, XPT2046_VDEV_REQ_HEAD_SIZE );
+	len = (uint32_t) req[2] | ((uint32_t) req[3] << 8 );
+
+	if ( len > XPT2046_VDEV_PAYLOAD_MAX )
+	{
+		alive = false;
+	}
+
+	if ( true == alive )
+	{
+		alive = vdev_read_all( fd, &req[ XPT2046_VDEV_REQ_HEAD_SIZE ], len );
+	}
+
+	if ( true == alive )
+	{
+		rsp[0] = req[0];
+
+		switch( req[0] )
+		{
+			case eXPT2046_VDEV_MSG_XFER:
+				for ( i = 0; i < len; i++ )
+				{
+					rsp[ XPT2046_VDEV_RSP_HEAD_SIZE + i ] = vdev_spi_byte( req[ XPT2046_VDEV_REQ_HEAD_SIZE + i ] );
+				}
+				rsp_len = len;
+
+				// 8 clocks per byte
+				vdev_advance_ns(( 8000000000ULL * len ) / g_chip.spi_clk );
+				break;
+
+			case eXPT2046_VDEV_MSG_ADVANCE:
+				if ( 4U == len )
+				{
+					vdev_advance_ns( 1000000ULL * (	(uint32_t) req[4] | ((uint32_t) req[5] << 8 )
+												|	((uint32_t) req[6] << 16 ) | ((uint32_t) req[7] << 24 )));
+				}
+				else
+				{
+					rsp[0] = eXPT2046_VDEV_MSG_ERROR;
+				}
+				break;
+
+			case eXPT2046_VDEV_MSG_SET_CLK:
+				if ( 4U == len )
+				{
+					clk = (	(uint32_t) req[4] | ((uint32_t) req[5] << 8 )
+						|	((uint32_t) req[6] << 16 ) | ((uint32_t) req[7] << 24 ));
+				}
+
+				if ( clk > 0U )
+				{
+					g_chip.spi_clk = clk;
+				}
+				else
+				{
+					rsp[0] = eXPT2046_VDEV_MSG_ERROR;
+				}
+				break;
+
+			default:
+				rsp[0] = eXPT2046_VDEV_MSG_ERROR;
+				break;
+		}
+
+		time_us = (uint32_t)( g_chip.time_ns / 1000ULL );
+
+		rsp[1] = ( true == vdev_penirq()) ? 1U : 0U;
+		rsp[2] = (uint8_t)( rsp_len );
+		rsp[3] = (uint8_t)( rsp_len >> 8 );
+		rsp[4] = (uint8_t)( time_us );
+		rsp[5] = (uint8_t)( time_us >> 8 );
+		rsp[6] = (uint8_t)( time_us >> 16 );
+		rsp[7] = (uint8_t)( time_us >> 24 );
+
+		alive = vdev_write_all( fd, rsp, XPT2046_VDEV_RSP_HEAD_SIZE + rsp_len );
+	}
+
+	return alive;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clock single byte through chip
+*
+* @note		Result of conversion started by control byte is shifted out
+* 			in following two bytes (12-bit result in bits 14..3, 8-bit
+* 			result in bits 14..7, first clock after control byte is busy).
+*
+* @param[in]	mosi	- Byte on DIN
+* @return 		miso	- Byte on DOUT
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t vdev_spi_byte(const uint8_t mosi)
+{
+	const uint8_t miso = (uint8_t)( g_chip.shift >> 8 );
+	uint16_t adc;
+
+	g_chip.shift = (uint16_t)( g_chip.shift << 8 );
+
+	if ( 0U != ( mosi & VDEV_CTRL_S ))
+	{
+		g_chip.pd = VDEV_CTRL_PD( mosi );
+		adc = vdev_convert( mosi );
+
+		if ( true == VDEV_CTRL_MODE_8BIT( mosi ))
+		{
+			g_chip.shift = (uint16_t)(( adc >> 4 ) << 7 );
+		}
+		else
+		{
+			g_chip.shift = (uint16_t)( adc << 3 );
+		}
+	}
+
+	return miso;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Convert selected channel
+*
+* @param[in]	ctrl	- Control byte
+* @return 		adc		- 12-bit conversion result
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t vdev_convert(const uint8_t ctrl)
+{
+	int32_t adc = 0;
+	int32_t noise = 0;
+	uint32_t z1;
+
+	if ( g_chip.noise > 0U )
+	{
+		noise = ( rand() % (int32_t)( 2U * g_chip.noise + 1U )) - (int32_t) g_chip.noise;
+	}
+
+	// Z1 such that X * ( Z2 - Z1 ) / Z1 == rt with Z2 == VDEV_Z2_REF
+	z1 = ( VDEV_Z2_REF * g_touch.x ) / ((uint32_t) g_touch.x + g_touch.rt + 1U );
+
+	switch( VDEV_CTRL_ADDR( ctrl ))
+	{
+		case eVDEV_CH_X:
+			adc = ( true == g_touch.pressed ) ? ( g_touch.x + noise ) : 0;
+			break;
+
+		case eVDEV_CH_Y:
+			adc = ( true == g_touch.pressed ) ? ( g_touch.y + noise ) : 0;
+			break;
+
+		case eVDEV_CH_Z1:
+			adc = ( true == g_touch.pressed ) ? (int32_t) z1 : 0;
+			break;
+
+		case eVDEV_CH_Z2:
+			adc = ( true == g_touch.pressed ) ? (int32_t) VDEV_Z2_REF : VDEV_ADC_MAX;
+			break;
+
+		case eVDEV_CH_TEMP0:
+			adc = VDEV_TEMP0_ADC;
+			break;
+
+		case eVDEV_CH_TEMP1:
+			adc = VDEV_TEMP1_ADC;
+			break;
+
+		case eVDEV_CH_VBAT:
+			adc = VDEV_VBAT_ADC;
+			break;
+
+		case eVDEV_CH_AUX:
+		default:
+			adc = VDEV_AUX_ADC;
+			break;
+	}
+
+	adc = vdev_settle( adc );
+
+	if ( adc < 0 )
+	{
+		adc = 0;
+	}
+	else if ( adc > VDEV_ADC_MAX )
+	{
+		adc = VDEV_ADC_MAX;
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return (uint16_t) adc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Settle sample capacitor during acquisition window
+*
+* @note		Capacitor charges from value of previous conversion towards
+* 			input with time constant tau_ns for VDEV_ACQ_CLK SPI clocks.
+*
+* @param[in]	adc		- Input value [LSB]
+* @return 		adc		- Sampled value [LSB]
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t vdev_settle(const int32_t adc)
+{
+	double v = (double) adc;
+
+	if ( g_chip.tau_ns > 0U )
+	{
+		v += ( g_chip.hold - v ) * vdev_exp_neg(( 1e9 * VDEV_ACQ_CLK ) / ((double) g_chip.spi_clk * g_chip.tau_ns ));
+	}
+
+	g_chip.hold = v;
+
+	return (int32_t)(( v < 0.0 ) ? ( v - 0.5 ) : ( v + 0.5 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate exp(-x) without libm
+*
+* @note		Argument is halved below 0.25, series is evaluated and
+* 			result squared back.
+*
+* @param[in]	x		- Non-negative argument
+* @return 		exp(-x)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double vdev_exp_neg(double x)
+{
+	double r = 0.0;
+	uint32_t n = 0U;
+
+	if ( x < 50.0 )
+	{
+		while ( x > 0.25 )
+		{
+			x *= 0.5;
+			n++;
+		}
+
+		r = 1.0 - x * ( 1.0 - x / 2.0 * ( 1.0 - x / 3.0 * ( 1.0 - x / 4.0 * ( 1.0 - x / 5.0 ))));
+
+		for ( ; n > 0U; n-- )
+		{
+			r *= r;
+		}
+	}
+
+	return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get PENIRQ state
+*
+* @return 		detected - True if touch is detected (PENIRQ low)
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool vdev_penirq(void)
+{
+	return (( true == g_touch.pressed ) && ( 0U == ( g_chip.pd & 0x01U )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Advance virtual time and play trace
+*
+* @param[in]	ns	- Time to advance [ns]
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void vdev_advance_ns(const uint64_t ns)
+{
+	g_chip.time_ns += ns;
+
+	while 	(	( true == g_trace.next_valid )
+			&&	( g_trace.next_ms * 1000000ULL <= g_chip.time_ns ))
+	{
+		g_touch = g_trace.next;
+		vdev_trace_next();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read next trace row
+*
+* @note		Trace is streamed, only single row is kept in memory.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void vdev_trace_next(void)
+{
+	char line[128];
+	unsigned long long t;
+	unsigned p, x, y, rt;
+
+	g_trace.next_valid = false;
+
+	while 	(	( false == g_trace.next_valid )
+			&&	( NULL != fgets( line, sizeof( line ), g_trace.p_file )))
+	{
+		if ( 5 == sscanf( line, "%llu,%u,%u,%u,%u", &t, &p, &x, &y, &rt ))
+		{
+			g_trace.next_ms 		= t;
+			g_trace.next.pressed 	= ( 0U != p );
+			g_trace.next.x 			= (uint16_t) x;
+			g_trace.next.y 			= (uint16_t) y;
+			g_trace.next.rt 		= (uint16_t) rt;
+			g_trace.next_valid 		= true;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Process single stdin command
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void vdev_stdin_cmd(void)
+{
+	char line[128];
+	unsigned x, y, rt;
+
+	if ( NULL == fgets( line, sizeof( line ), stdin ))
+	{
+		// Stdin closed, keep serving with last touch state
+		g_stdin_eof = true;
+	}
+	else if ( 3 == sscanf( line, "down %u %u %u", &x, &y, &rt ))
+	{
+		g_touch.pressed = true;
+		g_touch.x 		= (uint16_t) x;
+		g_touch.y 		= (uint16_t) y;
+		g_touch.rt 		= (uint16_t) rt;
+	}
+	else if ( 2 == sscanf( line, "move %u %u", &x, &y ))
+	{
+		g_touch.x 		= (uint16_t) x;
+		g_touch.y 		= (uint16_t) y;
+	}
+	else if ( 0 == strncmp( line, "up", 2 ))
+	{
+		g_touch.pressed = false;
+	}
+	else
+	{
+		fprintf( stderr, "xpt2046 vdev: unknown command: %s", line );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read exact number of bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool vdev_read_all(const int fd, uint8_t * p_buf, uint32_t len)
+{
+	ssize_t n = 1;
+
+	while (( len > 0U ) && ( n > 0 ))
+	{
+		n = read( fd, p_buf, len );
+
+		if ( n > 0 )
+		{
+			p_buf += n;
+			len -= (uint32_t) n;
+		}
+	}
+
+	return ( 0U == len );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write all bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool vdev_write_all(const int fd, const uint8_t * p_buf, uint32_t len)
+{
+	ssize_t n = 1;
+
+	while (( len > 0U ) && ( n > 0 ))
+	{
+		n = write( fd, p_buf, len );
+
+		if ( n > 0 )
+		{
+			p_buf += n;
+			len -= (uint32_t) n;
+		}
+	}
+
+	return ( 0U == len );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////